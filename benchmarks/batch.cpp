@@ -0,0 +1,52 @@
+#include "benchmark.hpp"
+
+#include "vta/algorithms.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+// Small enough to stay in cache so that the loop itself is measured rather than memory bandwidth
+std::size_t const rows = 4096;
+int const repetitions = 10000;
+
+auto const fma = [](float& out, float x, float y){ out += x * y; };
+auto const reversed_fma = [](float y, float x, float& out){ out += x * y; };
+
+}
+
+int main() {
+	std::vector<float> out(rows, 0.0f);
+	std::vector<float> x(rows, 1.5f);
+	std::vector<float> y(rows, 2.5f);
+
+	auto const naive = benchmark::time([&]{
+		for(std::size_t i = 0; i < rows; ++i) {
+			fma(out[i], x[i], y[i]);
+		}
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report("per-row call", naive / rows, "ns/row");
+
+	auto const batched = benchmark::time([&]{
+		vta::batch(fma)(out, x, y);
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report("vta::batch", batched / rows, "ns/row");
+
+	auto const naive_reversed = benchmark::time([&]{
+		auto const f = vta::forward_after<vta::reverse>(reversed_fma);
+		for(std::size_t i = 0; i < rows; ++i) {
+			f(out[i], x[i], y[i]);
+		}
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report("per-row forward_after<reverse>", naive_reversed / rows, "ns/row");
+
+	auto const batched_reversed = benchmark::time([&]{
+		vta::batch<vta::reverse>(reversed_fma)(out, x, y);
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report("vta::batch<reverse>", batched_reversed / rows, "ns/row");
+}
@@ -0,0 +1,47 @@
+#ifndef INCLUDE_GUARD_BENCHMARKS_BENCHMARK_HPP
+#define INCLUDE_GUARD_BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace benchmark {
+
+// Stops the compiler from optimising away a value that is otherwise unused
+template <typename T>
+void keep(T const& value) {
+	asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Returns the average time in nanoseconds of calling f
+template <typename Function>
+double time(Function&& f, int repetitions = 10) {
+	f();
+	auto const start = std::chrono::steady_clock::now();
+	for(int i = 0; i < repetitions; ++i) {
+		f();
+	}
+	auto const end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / repetitions;
+}
+
+// Runs a shell command, such as a compiler invocation, and exits if it fails
+inline void run(std::string const& command) {
+	if(std::system(command.c_str()) != 0) {
+		std::fprintf(stderr, "%s failed\n", command.c_str());
+		std::exit(EXIT_FAILURE);
+	}
+}
+
+inline void report(std::string const& name, double value, std::string const& unit) {
+	std::cout << std::left << std::setw(56) << name
+	          << std::right << std::setw(14) << std::fixed << std::setprecision(2) << value
+	          << ' ' << unit << std::endl;
+}
+
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include "benchmark.hpp"
+
+#include "vta/algorithms.hpp"
+#include "vta/bits.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+
+// Compares packing packs of bools into a bitmask one at a time, as examples/switch_bools.cpp does,
+// with vta::pack_bits, and the same for unpacking them with vta::unpack_bits and for mask_of
+
+namespace {
+
+int const repetitions = 1000000;
+
+struct count_set {
+	template <typename... Bools>
+	int operator()(Bools... bools) const {
+		return vta::foldl([](int lhs, int rhs){ return lhs + rhs; })(0, static_cast<int>(bools)...);
+	}
+};
+
+struct is_negative {
+	bool operator()(int x) const {
+		return x < 0;
+	}
+};
+
+template <std::size_t N, std::size_t... Is>
+void compare(bool const (&flags)[N], int const (&ints)[N], std::index_sequence<Is...>) {
+	std::string const name = std::to_string(N) + " ";
+	std::bitset<N> out;
+
+	auto const fold = benchmark::time([&]{
+		benchmark::keep(flags);
+		std::bitset<N> bits;
+		vta::map([&](bool b){ bits <<= 1; bits[0] = b; })(flags[Is]...);
+		out ^= bits;
+	}, repetitions);
+	benchmark::report(name + "bools packed one by one", fold, "ns");
+
+	auto const pack = benchmark::time([&]{
+		benchmark::keep(flags);
+		out ^= std::bitset<N>{vta::pack_bits(flags[Is]...)};
+	}, repetitions);
+	benchmark::report(name + "bools packed by vta::pack_bits", pack, "ns");
+
+	int count = 0;
+	auto const mask = vta::pack_bits(flags[Is]...);
+	auto const unpack_one_by_one = benchmark::time([&]{
+		benchmark::keep(mask);
+		std::bitset<N> const bits{mask};
+		count += count_set{}(bits[Is]...);
+	}, repetitions);
+	benchmark::report(name + "bits unpacked one by one", unpack_one_by_one, "ns");
+
+	auto const unpack = benchmark::time([&]{
+		benchmark::keep(mask);
+		count += vta::unpack_bits<N>(mask, count_set{});
+	}, repetitions);
+	benchmark::report(name + "bits unpacked by vta::unpack_bits", unpack, "ns");
+
+	auto const predicate = benchmark::time([&]{
+		benchmark::keep(ints);
+		std::bitset<N> bits;
+		vta::map([&](int x){ bits <<= 1; bits[0] = is_negative{}(x); })(ints[Is]...);
+		out ^= bits;
+	}, repetitions);
+	benchmark::report(name + "predicates packed one by one", predicate, "ns");
+
+	auto const mask_of = benchmark::time([&]{
+		benchmark::keep(ints);
+		out ^= std::bitset<N>{vta::mask_of(is_negative{})(ints[Is]...)};
+	}, repetitions);
+	benchmark::report(name + "predicates packed by vta::mask_of", mask_of, "ns");
+
+	benchmark::keep(out);
+	benchmark::keep(count);
+}
+
+template <std::size_t N>
+void compare() {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> generate(-100, 100);
+	bool flags[N];
+	int ints[N];
+	for(std::size_t i = 0; i < N; ++i) {
+		ints[i] = generate(eng);
+		flags[i] = ints[i] < 0;
+	}
+	compare(flags, ints, std::make_index_sequence<N>{});
+}
+
+}
+
+int main() {
+	compare<64>();
+	compare<512>();
+}
@@ -0,0 +1,101 @@
+#include "benchmark.hpp"
+
+#include "vta/compare.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Compares vta::compare and vta::equal with the operators of std::tuple, one pair of keys at a time
+// and as the comparison of std::sort, for keys of small integers, of wide integers and of integers
+// and a string. The fields take few values, so that neighbouring keys often share their first fields.
+
+namespace {
+
+std::size_t const keys = 1 << 16;
+int const repetitions = 20;
+
+struct tuple_less {
+	template <typename Key>
+	bool operator()(Key const& lhs, Key const& rhs) const {
+		return lhs < rhs;
+	}
+};
+
+struct vta_less {
+	template <typename Key>
+	bool operator()(Key const& lhs, Key const& rhs) const {
+		return vta::compare(lhs, rhs) < 0;
+	}
+};
+
+struct tuple_equal {
+	template <typename Key>
+	bool operator()(Key const& lhs, Key const& rhs) const {
+		return lhs == rhs;
+	}
+};
+
+template <typename Less, typename Equal, typename Key>
+void measure(std::string const& name, std::vector<Key> const& data) {
+	auto const comparing = benchmark::time([&]{
+		std::size_t total = 0;
+		for(std::size_t i = 1; i < data.size(); ++i) {
+			total += Less{}(data[i - 1], data[i]);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	auto const equality = benchmark::time([&]{
+		std::size_t total = 0;
+		for(std::size_t i = 1; i < data.size(); ++i) {
+			total += Equal{}(data[i - 1], data[i]);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	std::vector<Key> sorted;
+	auto const sorting = benchmark::time([&]{
+		sorted = data;
+		std::sort(sorted.begin(), sorted.end(), Less{});
+		benchmark::keep(sorted.front());
+	}, repetitions);
+
+	benchmark::report(name + " less", comparing / data.size(), "ns/key");
+	benchmark::report(name + " equal", equality / data.size(), "ns/key");
+	benchmark::report(name + " std::sort", sorting / data.size(), "ns/key");
+}
+
+template <typename Key>
+void run(std::string const& name, std::vector<Key> const& data) {
+	measure<tuple_less, tuple_equal>("std::tuple of " + name, data);
+	measure<vta_less, vta::equal_f>("vta::compare of " + name, data);
+}
+
+}
+
+int main() {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> small{0, 3};
+	std::uniform_int_distribution<std::int64_t> wide{0, 3};
+
+	typedef std::tuple<short, short, short, short, char, char> small_key;
+	std::vector<small_key> small_keys;
+	typedef std::tuple<int, std::int64_t, std::int64_t> wide_key;
+	std::vector<wide_key> wide_keys;
+	typedef std::tuple<int, std::string, unsigned> string_key;
+	std::vector<string_key> string_keys;
+	for(std::size_t i = 0; i < keys; ++i) {
+		small_keys.emplace_back(small(eng), small(eng), small(eng), small(eng), small(eng), small(eng));
+		wide_keys.emplace_back(small(eng), wide(eng) << 40, wide(eng));
+		string_keys.emplace_back(small(eng), "key" + std::to_string(small(eng)), small(eng));
+	}
+
+	run("6 small fields", small_keys);
+	run("3 wide fields", wide_keys);
+	run("an int, a string and an unsigned", string_keys);
+}
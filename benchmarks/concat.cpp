@@ -0,0 +1,46 @@
+#include "benchmark.hpp"
+
+#include "vta/concat.hpp"
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+int const repetitions = 100000;
+
+}
+
+int main() {
+	std::string const name = "benchmark";
+	int const id = 123456;
+	double const value = 2.75;
+
+	auto const stream = benchmark::time([&]{
+		std::ostringstream ss;
+		ss << "name=" << name << ", id=" << id << ", value=" << value << ';';
+		benchmark::keep(ss.str());
+	}, repetitions);
+	benchmark::report("std::ostringstream", stream, "ns/call");
+
+	auto const plus = benchmark::time([&]{
+		std::string const str = "name=" + name + ", id=" + std::to_string(id) + ", value="
+		                      + std::to_string(value) + ';';
+		benchmark::keep(str);
+	}, repetitions);
+	benchmark::report("operator+", plus, "ns/call");
+
+	auto const concat = benchmark::time([&]{
+		std::string const str = vta::concat("name=", name, ", id=", id, ", value=", value, ';');
+		benchmark::keep(str);
+	}, repetitions);
+	benchmark::report("vta::concat", concat, "ns/call");
+
+	std::string reused;
+	auto const append = benchmark::time([&]{
+		reused.clear();
+		vta::append(reused, "name=", name, ", id=", id, ", value=", value, ';');
+		benchmark::keep(reused);
+	}, repetitions);
+	benchmark::report("vta::append into a reused string", append, "ns/call");
+}
@@ -0,0 +1,107 @@
+#include "benchmark.hpp"
+
+#include "vta/algorithms.hpp"
+
+#include <string>
+
+// Built with -O0 to measure what VTA costs in debug and sanitizer builds
+
+namespace {
+
+int const repetitions = 100000;
+
+struct sink {
+	int* out;
+
+	template <typename... Args>
+	void operator()(Args... args) const {
+		int const values[] = {0, args...};
+		*out += values[sizeof...(Args)];
+	}
+};
+
+struct add_to {
+	int* out;
+
+	void operator()(int x) const {
+		*out += x;
+	}
+};
+
+struct is_positive {
+	bool operator()(int x) const {
+		return x > 0;
+	}
+};
+
+struct plus {
+	int operator()(int lhs, int rhs) const {
+		return lhs + rhs;
+	}
+};
+
+#if VTA_FLATTEN
+std::string const mode = "";
+#else
+std::string const mode = " (VTA_FLATTEN=0)";
+#endif
+
+#define VTA_ARGS_20 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20
+
+}
+
+int main() {
+	int out = 0;
+
+	auto const reverse = benchmark::time([&]{
+		vta::forward_after<vta::reverse>(sink{&out})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 reverse of 20 arguments" + mode, reverse, "ns/call");
+
+	auto const cycle = benchmark::time([&]{
+		vta::forward_after<vta::cycle<0, 5, 10, 15, 19>>(sink{&out})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 cycle<0, 5, 10, 15, 19> of 20 arguments" + mode, cycle, "ns/call");
+
+	auto const shifts = benchmark::time([&]{
+		vta::forward_after<vta::compose<vta::left_shift<3>, vta::shift_tail<-7>, vta::drop<2>, vta::take<-1>>>(sink{&out})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 compose of 4 shifts of 20 arguments" + mode, shifts, "ns/call");
+
+	auto const map = benchmark::time([&]{
+		vta::map(add_to{&out})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 map over 20 arguments" + mode, map, "ns/call");
+
+	auto const all_of = benchmark::time([&]{
+		out += vta::all_of(is_positive{})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 all_of over 20 arguments" + mode, all_of, "ns/call");
+
+	auto const foldl = benchmark::time([&]{
+		out += vta::foldl(plus{})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 foldl over 20 arguments" + mode, foldl, "ns/call");
+
+	auto const at = benchmark::time([&]{
+		out += vta::at<-1>(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 at<-1> of 20 arguments" + mode, at, "ns/call");
+
+	auto const foldr = benchmark::time([&]{
+		out += vta::foldr(plus{})(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 foldr over 20 arguments" + mode, foldr, "ns/call");
+
+	auto const last = benchmark::time([&]{
+		out += vta::last(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 last of 20 arguments" + mode, last, "ns/call");
+
+	auto const adjacent_map = benchmark::time([&]{
+		vta::adjacent_map<2>([&out](int lhs, int rhs) { out += lhs * rhs; })(VTA_ARGS_20);
+	}, repetitions);
+	benchmark::report("-O0 adjacent_map<2> over 20 arguments" + mode, adjacent_map, "ns/call");
+
+	benchmark::keep(out);
+}
@@ -0,0 +1,91 @@
+#include "benchmark.hpp"
+
+#include "vta/function_ref.hpp"
+#include "vta/functions.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Compares passing distinct lambdas to foldl, which instantiates foldl for each of them, with
+// passing them through vta::function_ref, which shares one instantiation but calls indirectly.
+// VTA_CXX_COMPILER, VTA_INCLUDE_DIR and VTA_SCRATCH_DIR, the build directory that the translation
+// unit and its object file are written to, are set by benchmarks/CMakeLists.txt.
+
+namespace {
+
+int const repetitions = 1000000;
+int const compile_repetitions = 3;
+int const lambdas = 50;
+
+#define VTA_VALUES_16 values[0], values[1], values[2], values[3], values[4], values[5], values[6], \
+  values[7], values[8], values[9], values[10], values[11], values[12], values[13], values[14], values[15]
+#define VTA_STRINGIZE(...) #__VA_ARGS__
+#define VTA_EXPAND_STRINGIZE(...) VTA_STRINGIZE(__VA_ARGS__)
+#define VTA_STRINGIZE_VALUES VTA_EXPAND_STRINGIZE(VTA_VALUES_16)
+
+// Writes a translation unit that folds 16 ints with each of a number of distinct lambdas
+void write_source(std::string const& path) {
+	std::ofstream out{path};
+	out << "#include \"vta/function_ref.hpp\"\n"
+	       "#include \"vta/functions.hpp\"\n";
+	for(int i = 0; i < lambdas; ++i) {
+		out << "int fold_" << i << "(int const* values) {\n"
+		       "\tauto f = [](int lhs, int rhs) { return lhs * " << i << " + rhs; };\n"
+		       "#ifdef ERASED\n"
+		       "\treturn vta::foldl(vta::function_ref<int(int, int)>{f})(" VTA_STRINGIZE_VALUES ");\n"
+		       "#else\n"
+		       "\treturn vta::foldl(f)(" VTA_STRINGIZE_VALUES ");\n"
+		       "#endif\n"
+		       "}\n";
+	}
+}
+
+long file_size(std::string const& path) {
+	std::ifstream in{path, std::ios::binary | std::ios::ate};
+	return static_cast<long>(in.tellg());
+}
+
+void compile(std::string const& source, std::string const& flags, std::string const& label) {
+	std::string const object = VTA_SCRATCH_DIR "/function_ref_benchmark_scratch.o";
+	std::string const command = std::string{VTA_CXX_COMPILER} + " -std=c++14 -c -I" VTA_INCLUDE_DIR " " + flags
+	                          + " " + source + " -o " + object;
+	auto const nanoseconds = benchmark::time([&]{ benchmark::run(command); }, compile_repetitions);
+	benchmark::report("compile " + label, nanoseconds / 1e6, "ms");
+	benchmark::report("object size " + label, file_size(object), "bytes");
+	std::remove(object.c_str());
+}
+
+}
+
+int main() {
+	std::string const source = VTA_SCRATCH_DIR "/function_ref_benchmark_scratch.cpp";
+	write_source(source);
+	for(std::string const optimisation : {"-O0", "-O2"}) {
+		compile(source, optimisation, std::to_string(lambdas) + " lambdas " + optimisation);
+		compile(source, optimisation + " -DERASED", std::to_string(lambdas) + " function_refs " + optimisation);
+	}
+	std::remove(source.c_str());
+
+	int values[16] = {};
+	benchmark::keep(values);
+	int out = 0;
+	auto const f = [](int lhs, int rhs) { return lhs * 3 + rhs; };
+
+	auto const direct = benchmark::time([&]{
+		benchmark::keep(values);
+		out += vta::foldl(f)(VTA_VALUES_16);
+	}, repetitions);
+	benchmark::report("foldl of 16 ints with a lambda", direct, "ns/call");
+
+	vta::function_ref<int(int, int)> ref = f;
+	auto const erased = benchmark::time([&]{
+		// Hides what ref refers to, as it would be when it is passed in from elsewhere
+		benchmark::keep(ref);
+		benchmark::keep(values);
+		out += vta::foldl(ref)(VTA_VALUES_16);
+	}, repetitions);
+	benchmark::report("foldl of 16 ints with a function_ref", erased, "ns/call");
+
+	benchmark::keep(out);
+}
@@ -0,0 +1,93 @@
+#include "benchmark.hpp"
+
+#include "vta/hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+// Compares vta::hash with a fold of boost::hash_combine over the std::hash of each field, for keys
+// of small integers, of wide integers and of an integer and a string
+
+namespace {
+
+std::size_t const keys = 1 << 16;
+int const repetitions = 50;
+
+// The combining step of boost::hash_combine before Boost 1.81
+inline void hash_combine(std::size_t& seed, std::size_t value) {
+	seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+struct combine_hash {
+	template <typename... Ts>
+	std::size_t operator()(std::tuple<Ts...> const& key) const {
+		std::size_t seed = 0;
+		vta::map([&seed](auto const& field) {
+			hash_combine(seed, std::hash<std::decay_t<decltype(field)>>{}(field));
+		})(vta::unpack(key));
+		return seed;
+	}
+};
+
+struct vta_hash {
+	template <typename... Ts>
+	std::size_t operator()(std::tuple<Ts...> const& key) const {
+		return vta::hash_f{}(vta::unpack(key));
+	}
+};
+
+template <typename Hash, typename Key>
+void measure(std::string const& name, std::vector<Key> const& data) {
+	auto const hashing = benchmark::time([&]{
+		std::size_t total = 0;
+		for(Key const& key : data) {
+			total += Hash{}(key);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	std::unordered_set<Key, Hash> set(data.begin(), data.end());
+	auto const lookup = benchmark::time([&]{
+		std::size_t found = 0;
+		for(Key const& key : data) {
+			found += set.count(key);
+		}
+		benchmark::keep(found);
+	}, repetitions);
+
+	benchmark::report(name + " hash", hashing / data.size(), "ns/key");
+	benchmark::report(name + " unordered_set::count", lookup / data.size(), "ns/key");
+}
+
+}
+
+int main() {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> small{0, 15};
+	std::uniform_int_distribution<std::int64_t> wide{0, 1 << 20};
+
+	typedef std::tuple<short, short, short, short, char, char> small_key;
+	std::vector<small_key> small_keys;
+	typedef std::tuple<int, std::int64_t, std::int64_t> wide_key;
+	std::vector<wide_key> wide_keys;
+	typedef std::tuple<int, std::string> string_key;
+	std::vector<string_key> string_keys;
+	for(std::size_t i = 0; i < keys; ++i) {
+		small_keys.emplace_back(small(eng), small(eng), small(eng), small(eng), small(eng), small(eng));
+		wide_keys.emplace_back(small(eng), wide(eng), wide(eng));
+		string_keys.emplace_back(small(eng), "key" + std::to_string(wide(eng)));
+	}
+
+	measure<combine_hash>("hash_combine of 6 small fields", small_keys);
+	measure<vta_hash>("vta::hash of 6 small fields", small_keys);
+	measure<combine_hash>("hash_combine of 3 wide fields", wide_keys);
+	measure<vta_hash>("vta::hash of 3 wide fields", wide_keys);
+	measure<combine_hash>("hash_combine of an int and a string", string_keys);
+	measure<vta_hash>("vta::hash of an int and a string", string_keys);
+}
@@ -0,0 +1,86 @@
+#include "benchmark.hpp"
+
+#include "vta/memoize.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Compares calling an expensive function directly, through vta::memoize and through a cache of a
+// std::map behind one std::mutex, on a stream of arguments that mostly repeat
+
+namespace {
+
+std::size_t const calls = 1 << 14;
+int const repetitions = 20;
+
+// Stands in for a pure function that is slow to compute
+double expensive(int n, std::string const& name) {
+	double result = static_cast<double>(name.size());
+	for(int i = 1; i <= 2000; ++i) {
+		result += static_cast<double>(n % i) / i;
+	}
+	return result;
+}
+
+}
+
+int main() {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> pick{0, 255};
+	std::string const names[] = {"alpha", "beta", "gamma", "delta"};
+	std::vector<std::tuple<int, std::string>> arguments;
+	for(std::size_t i = 0; i < calls; ++i) {
+		int const n = pick(eng);
+		arguments.emplace_back(n, names[n % 4]);
+	}
+
+	auto const direct = benchmark::time([&]{
+		double total = 0.0;
+		for(auto const& args : arguments) {
+			total += expensive(std::get<0>(args), std::get<1>(args));
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	auto const memoized = vta::memoize(expensive, 1024);
+	auto const memoize = benchmark::time([&]{
+		double total = 0.0;
+		for(auto const& args : arguments) {
+			total += *memoized(std::get<0>(args), std::get<1>(args));
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	std::mutex mutex;
+	std::map<std::tuple<int, std::string>, std::shared_ptr<double const>> cache;
+	auto const locked_map = benchmark::time([&]{
+		double total = 0.0;
+		for(auto const& args : arguments) {
+			std::shared_ptr<double const> result;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				auto const it = cache.find(args);
+				if(it != cache.end()) {
+					result = it->second;
+				}
+			}
+			if(!result) {
+				result = std::make_shared<double const>(expensive(std::get<0>(args), std::get<1>(args)));
+				std::lock_guard<std::mutex> lock(mutex);
+				cache.emplace(args, result);
+			}
+			total += *result;
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	benchmark::report("direct call", direct / calls, "ns/call");
+	benchmark::report("vta::memoize", memoize / calls, "ns/call");
+	benchmark::report("std::map behind a std::mutex", locked_map / calls, "ns/call");
+	benchmark::report("vta::memoize hit rate", memoized.statistics().hit_rate() * 100.0, "%");
+}
@@ -0,0 +1,108 @@
+#include "benchmark.hpp"
+
+#include "vta/merge.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Compares vta::merge of K sorted runs with a std::priority_queue and with merging the runs in
+// pairs with std::merge until one is left
+
+namespace {
+
+std::size_t const total = 1 << 18;
+int const repetitions = 20;
+
+std::vector<std::vector<int>> make_runs(std::size_t k) {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> generate;
+	std::vector<std::vector<int>> runs(k);
+	for(auto& run : runs) {
+		run.resize(total / k);
+		for(int& x : run) {
+			x = generate(eng);
+		}
+		std::sort(run.begin(), run.end());
+	}
+	return runs;
+}
+
+template <std::size_t... Is>
+void vta_merge(std::vector<std::vector<int>> const& runs, std::vector<int>& out, std::index_sequence<Is...>) {
+	vta::merge(out.begin(), runs[Is]...);
+}
+
+void priority_queue_merge(std::vector<std::vector<int>> const& runs, std::vector<int>& out) {
+	typedef std::pair<int, std::size_t> entry;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+	std::vector<std::size_t> positions(runs.size(), 0);
+	for(std::size_t i = 0; i < runs.size(); ++i) {
+		if(!runs[i].empty()) {
+			queue.emplace(runs[i][0], i);
+		}
+	}
+
+	auto it = out.begin();
+	while(!queue.empty()) {
+		entry const top = queue.top();
+		queue.pop();
+		*it++ = top.first;
+		std::size_t const i = top.second;
+		if(++positions[i] < runs[i].size()) {
+			queue.emplace(runs[i][positions[i]], i);
+		}
+	}
+}
+
+void pairwise_merge(std::vector<std::vector<int>> runs, std::vector<int>& out) {
+	while(runs.size() > 1) {
+		std::vector<std::vector<int>> merged;
+		for(std::size_t i = 0; i + 1 < runs.size(); i += 2) {
+			merged.emplace_back(runs[i].size() + runs[i + 1].size());
+			std::merge(runs[i].begin(), runs[i].end(), runs[i + 1].begin(), runs[i + 1].end(), merged.back().begin());
+		}
+		if(runs.size() % 2 == 1) {
+			merged.push_back(std::move(runs.back()));
+		}
+		runs = std::move(merged);
+	}
+	out = std::move(runs[0]);
+}
+
+template <std::size_t K>
+void compare() {
+	auto const runs = make_runs(K);
+	std::vector<int> out(total);
+	std::string const name = std::to_string(K) + " runs";
+
+	auto const tree = benchmark::time([&]{
+		vta_merge(runs, out, std::make_index_sequence<K>{});
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report(name + " vta::merge", tree / total, "ns/element");
+
+	auto const queue = benchmark::time([&]{
+		priority_queue_merge(runs, out);
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report(name + " std::priority_queue", queue / total, "ns/element");
+
+	auto const pairs = benchmark::time([&]{
+		pairwise_merge(runs, out);
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report(name + " std::merge in pairs", pairs / total, "ns/element");
+}
+
+}
+
+int main() {
+	compare<2>();
+	compare<4>();
+	compare<8>();
+	compare<16>();
+}
@@ -0,0 +1,68 @@
+#include "benchmark.hpp"
+
+#include "vta/numeric.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+// The overflow-free mean from examples/safe_mean.cpp
+template <typename T, int Size>
+struct running {
+	T total;
+	T remainder;
+};
+
+template <typename T, int N>
+constexpr running<T, N> safe_mean_foldl(running<T, N> r, T t) noexcept {
+	return running<T, N>{(r.total + t / N) + (r.remainder + t % N) / N,
+	                     (r.remainder + t % N) % N};
+}
+
+template <typename Arg, typename... Args, int N = sizeof...(Args) + 1>
+constexpr Arg safe_mean(Arg arg, Args... args) noexcept {
+	return vta::add_const(vta::foldl(&safe_mean_foldl<Arg, N>))
+	  (running<Arg, N>{0, 0}, arg, args...).total;
+}
+
+std::size_t const rows = 1 << 16;
+int const repetitions = 100;
+
+template <typename T>
+void compare(std::string const& name) {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<T> generate(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+	std::vector<T> a(rows), b(rows), c(rows), d(rows), e(rows);
+	for(std::size_t i = 0; i < rows; ++i) {
+		a[i] = generate(eng);
+		b[i] = generate(eng);
+		c[i] = generate(eng);
+		d[i] = generate(eng);
+		e[i] = generate(eng);
+	}
+
+	std::vector<T> out(rows);
+	auto const example = benchmark::time([&]{
+		for(std::size_t i = 0; i < rows; ++i) {
+			out[i] = safe_mean(a[i], b[i], c[i], d[i], e[i]);
+		}
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report(name + " examples/safe_mean.cpp", example / rows, "ns/mean");
+
+	auto const numeric = benchmark::time([&]{
+		for(std::size_t i = 0; i < rows; ++i) {
+			out[i] = vta::numeric::mean(a[i], b[i], c[i], d[i], e[i]);
+		}
+		benchmark::keep(out);
+	}, repetitions);
+	benchmark::report(name + " vta::numeric::mean", numeric / rows, "ns/mean");
+}
+
+}
+
+int main() {
+	compare<int>("int");
+	compare<long long>("long long");
+}
@@ -0,0 +1,46 @@
+#include "benchmark.hpp"
+
+#include "vta/packed_tuple.hpp"
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct tag {};
+
+int const records = 1000000;
+
+template <std::size_t I, typename Tuple>
+auto const& element(Tuple const& t) {
+	using std::get;
+	return get<I>(t);
+}
+
+template <template <class...> class Tuple, typename... Ts>
+void footprint(std::string const& name) {
+	std::vector<Tuple<Ts...>> v(records);
+	benchmark::report(name + " sizeof", sizeof(Tuple<Ts...>), "bytes");
+	benchmark::report(name + " 1M records", v.size() * sizeof(Tuple<Ts...>) / (1024.0 * 1024.0), "MiB");
+	auto const ns = benchmark::time([&v]{
+		std::int64_t sum = 0;
+		for(auto const& t : v) {
+			sum += element<sizeof...(Ts) - 1>(t);
+		}
+		benchmark::keep(sum);
+	});
+	benchmark::report(name + " scan last member", ns / records, "ns/record");
+}
+
+template <typename... Ts>
+using packed = vta::packed_tuple<Ts...>;
+
+}
+
+int main() {
+	footprint<std::tuple, char, double, char, int>("std::tuple<char, double, char, int>");
+	footprint<packed, char, double, char, int>("vta::packed_tuple<char, double, char, int>");
+	footprint<std::tuple, bool, std::int64_t, std::int16_t, tag, std::int32_t>("std::tuple<bool, i64, i16, tag, i32>");
+	footprint<packed, bool, std::int64_t, std::int16_t, tag, std::int32_t>("vta::packed_tuple<bool, i64, i16, tag, i32>");
+}
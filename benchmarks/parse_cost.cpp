@@ -0,0 +1,42 @@
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Times the compiler on a translation unit that only includes one header, to show what each
+// component header costs a translation unit that includes it. VTA_CXX_COMPILER, VTA_INCLUDE_DIR and
+// VTA_SCRATCH_DIR, the build directory that the translation unit is written to, are set by
+// benchmarks/CMakeLists.txt.
+
+namespace {
+
+int const repetitions = 5;
+
+double parse_cost(std::string const& header) {
+	std::string const source = VTA_SCRATCH_DIR "/parse_cost_benchmark_scratch.cpp";
+	std::ofstream{source} << "#include " << header << "\n";
+	std::string const command = std::string{VTA_CXX_COMPILER} + " -std=c++14 -fsyntax-only -I" VTA_INCLUDE_DIR " "
+	                          + source;
+	auto const nanoseconds = benchmark::time([&]{ benchmark::run(command); }, repetitions);
+	std::remove(source.c_str());
+	return nanoseconds / 1e6;
+}
+
+}
+
+int main() {
+	std::string const headers[] = {
+		"<type_traits>",
+		"\"vta/core.hpp\"",
+		"\"vta/predicates.hpp\"",
+		"\"vta/access.hpp\"",
+		"\"vta/transformations.hpp\"",
+		"\"vta/functions.hpp\"",
+		"\"vta/algorithms.hpp\"",
+	};
+
+	for(auto const& header : headers) {
+		benchmark::report("parse " + header, parse_cost(header), "ms/TU");
+	}
+}
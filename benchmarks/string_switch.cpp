@@ -0,0 +1,101 @@
+#include "benchmark.hpp"
+
+#include "vta/string_switch.hpp"
+
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Compares dispatching on 16 command names with vta::string_switch, with a chain of == comparisons
+// and with an unordered_map from name to std::function
+
+namespace {
+
+std::size_t const lookups = 1 << 16;
+int const repetitions = 50;
+
+char const* const commands[] = {"GET", "SET", "DEL", "EXISTS", "INCR", "DECR", "EXPIRE", "TTL",
+                                "LPUSH", "RPUSH", "LPOP", "RPOP", "HGET", "HSET", "SADD", "SMEMBERS"};
+std::size_t const command_count = sizeof(commands) / sizeof(commands[0]);
+
+#define COMMAND(name, value) vta::string_case(VTA_STRING(name), [&total] { total += value; })
+
+bool with_string_switch(std::string const& input, int& total) {
+	return vta::string_switch(input,
+	                          COMMAND("GET", 1), COMMAND("SET", 2), COMMAND("DEL", 3), COMMAND("EXISTS", 4),
+	                          COMMAND("INCR", 5), COMMAND("DECR", 6), COMMAND("EXPIRE", 7), COMMAND("TTL", 8),
+	                          COMMAND("LPUSH", 9), COMMAND("RPUSH", 10), COMMAND("LPOP", 11), COMMAND("RPOP", 12),
+	                          COMMAND("HGET", 13), COMMAND("HSET", 14), COMMAND("SADD", 15),
+	                          COMMAND("SMEMBERS", 16));
+}
+
+#undef COMMAND
+
+bool with_equal_chain(std::string const& input, int& total) {
+	if(input == "GET") { total += 1; }
+	else if(input == "SET") { total += 2; }
+	else if(input == "DEL") { total += 3; }
+	else if(input == "EXISTS") { total += 4; }
+	else if(input == "INCR") { total += 5; }
+	else if(input == "DECR") { total += 6; }
+	else if(input == "EXPIRE") { total += 7; }
+	else if(input == "TTL") { total += 8; }
+	else if(input == "LPUSH") { total += 9; }
+	else if(input == "RPUSH") { total += 10; }
+	else if(input == "LPOP") { total += 11; }
+	else if(input == "RPOP") { total += 12; }
+	else if(input == "HGET") { total += 13; }
+	else if(input == "HSET") { total += 14; }
+	else if(input == "SADD") { total += 15; }
+	else if(input == "SMEMBERS") { total += 16; }
+	else { return false; }
+	return true;
+}
+
+}
+
+int main() {
+	int total = 0;
+	std::unordered_map<std::string, std::function<void()>> handlers;
+	for(std::size_t i = 0; i < command_count; ++i) {
+		int const value = static_cast<int>(i) + 1;
+		handlers[commands[i]] = [&total, value] { total += value; };
+	}
+
+	// One in eight inputs is not a command
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<std::size_t> pick{0, command_count + command_count / 7};
+	std::vector<std::string> inputs;
+	for(std::size_t i = 0; i < lookups; ++i) {
+		std::size_t const j = pick(eng);
+		inputs.push_back(j < command_count ? commands[j] : "UNKNOWN");
+	}
+
+	auto const string_switch = benchmark::time([&]{
+		for(std::string const& input : inputs) {
+			with_string_switch(input, total);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+	auto const equal_chain = benchmark::time([&]{
+		for(std::string const& input : inputs) {
+			with_equal_chain(input, total);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+	auto const map = benchmark::time([&]{
+		for(std::string const& input : inputs) {
+			auto const it = handlers.find(input);
+			if(it != handlers.end()) {
+				it->second();
+			}
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	benchmark::report("vta::string_switch of 16 strings", string_switch / lookups, "ns/lookup");
+	benchmark::report("== chain of 16 strings", equal_chain / lookups, "ns/lookup");
+	benchmark::report("unordered_map<string, function>::find of 16 strings", map / lookups, "ns/lookup");
+}
@@ -0,0 +1,101 @@
+#include "benchmark.hpp"
+
+#include "vta/type_map.hpp"
+
+#include <cstdint>
+#include <random>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Compares finding the state of a type from a runtime id with vta::type_map, with an unordered_map
+// keyed by vta::type_id and with an unordered_map keyed by std::type_index
+
+namespace {
+
+std::size_t const lookups = 1 << 16;
+int const repetitions = 50;
+
+template <int>
+struct key {};
+
+template <typename Sequence>
+struct map_of;
+
+template <int... Is>
+struct map_of<std::integer_sequence<int, Is...>> {
+	typedef vta::type_map<int, key<Is>...> type;
+
+	static std::vector<std::uint64_t> ids() {
+		return {vta::type_id<key<Is>>()...};
+	}
+
+	static std::vector<std::type_index> type_indices() {
+		return {std::type_index(typeid(key<Is>))...};
+	}
+};
+
+template <int N>
+void run() {
+	typedef map_of<std::make_integer_sequence<int, N>> types;
+	std::vector<std::uint64_t> const ids = types::ids();
+	std::vector<std::type_index> const type_indices = types::type_indices();
+
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> pick{0, N - 1};
+	std::vector<int> order(lookups);
+	for(int& i : order) {
+		i = pick(eng);
+	}
+	std::vector<std::uint64_t> id_order;
+	std::vector<std::type_index> type_index_order;
+	for(int i : order) {
+		id_order.push_back(ids[i]);
+		type_index_order.push_back(type_indices[i]);
+	}
+
+	typename types::type map(1);
+	std::unordered_map<std::uint64_t, int> by_id;
+	std::unordered_map<std::type_index, int> by_type_index;
+	for(int i = 0; i < N; ++i) {
+		by_id[ids[i]] = 1;
+		by_type_index[type_indices[i]] = 1;
+	}
+
+	auto const type_map = benchmark::time([&]{
+		int total = 0;
+		for(std::uint64_t id : id_order) {
+			total += *map.find(id);
+		}
+		benchmark::keep(total);
+	}, repetitions);
+	auto const id_map = benchmark::time([&]{
+		int total = 0;
+		for(std::uint64_t id : id_order) {
+			total += by_id.find(id)->second;
+		}
+		benchmark::keep(total);
+	}, repetitions);
+	auto const type_index_map = benchmark::time([&]{
+		int total = 0;
+		for(std::type_index const& index : type_index_order) {
+			total += by_type_index.find(index)->second;
+		}
+		benchmark::keep(total);
+	}, repetitions);
+
+	std::string const label = " of " + std::to_string(N) + " types";
+	benchmark::report("vta::type_map::find" + label, type_map / lookups, "ns/lookup");
+	benchmark::report("unordered_map<uint64_t>::find" + label, id_map / lookups, "ns/lookup");
+	benchmark::report("unordered_map<type_index>::find" + label, type_index_map / lookups, "ns/lookup");
+}
+
+}
+
+int main() {
+	run<16>();
+	run<64>();
+	run<256>();
+}
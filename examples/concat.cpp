@@ -9,13 +9,12 @@ std::size_t string_size(std::string const& str) noexcept { return str.size(); }
 std::size_t string_size(char const* str) noexcept { return std::strlen(str); }
 std::size_t string_size(char) noexcept { return 1; }
 
-auto const sum = [](auto lhs, auto rhs){ return lhs + rhs; };
-
 template <typename... Args>
 std::string concat(Args&&... args) {
 	std::string str;
-	str.reserve(vta::foldl(sum)(0ul, string_size(args)...));
-	vta::map([&str](auto const& append){ str += append; })(args...);
+	vta::accumulate_into(str,
+	                     [](std::string& s, auto const& append){ s += append; },
+	                     VTA_FN_TO_FUNCTOR(string_size))(args...);
 	return str;
 }
 
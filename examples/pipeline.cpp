@@ -0,0 +1,36 @@
+#include "vta/algorithms.hpp"
+
+#include <iostream>
+#include <utility>
+
+// examples/CMakeLists.txt builds this at several values of PACK_SIZE so that the symbol_size test
+// can check that the symbols and code grow no faster than the parameter pack
+#ifndef PACK_SIZE
+#define PACK_SIZE 8
+#endif
+
+struct print {
+	template <typename T>
+	void operator()(T const& t) const {
+		std::cout << t << ' ';
+	}
+};
+
+// Moves the last argument to the front, rotates the first three, reverses them all, drops the new
+// first argument and then shifts the rest left by one. All of these only reorder the arguments, so
+// compose applies them in a single step.
+typedef vta::compose<vta::swap<0, -1>,
+                     vta::cycle<0, 1, 2>,
+                     vta::reverse,
+                     vta::drop<1>,
+                     vta::shift<1>> pipeline;
+
+template <int... Is>
+void run(std::integer_sequence<int, Is...>) {
+	vta::forward_after<pipeline>(vta::map(print{}))(Is...);
+	std::cout << std::endl;
+}
+
+int main() {
+	run(std::make_integer_sequence<int, PACK_SIZE>{});
+}
@@ -1,19 +1,20 @@
 #include "vta/algorithms.hpp"
+#include "vta/bits.hpp"
 
-#include <climits>
+#include <cstdint>
 #include <iostream>
 #include <random>
 #include <type_traits>
 
-constexpr int calculate_switch(int a, bool b) noexcept { return 2 * a + b; }
-
+// pack_bits is constexpr for up to 64 bools, so the result can be used as a case label
 template <typename... Bools>
-constexpr int switch_bools(Bools... bools) noexcept {
-	static_assert(sizeof...(bools) < sizeof(int) * CHAR_BIT, "Too many parameters to switch_bools");
+constexpr std::uint64_t switch_bools(Bools... bools) noexcept {
 	static_assert(vta::are_same_after<std::decay, bool, Bools...>::value, "");
-	return vta::add_const(vta::foldl(&calculate_switch))(0, bools...);
+	return vta::pack_bits(bools...);
 }
 
+static_assert(switch_bools(true, false, false, false, false, false, false, false, true) == 0x101, "");
+
 int main() {
 	std::random_device rd;
 	std::mt19937 eng{rd()};
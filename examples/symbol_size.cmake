@@ -0,0 +1,75 @@
+# Reports the size of the symbol table and of .text for each of the example programs, and fails if
+# the pipeline example grows faster than its parameter pack.
+#
+# cmake -DNM=<nm> -DSIZE=<size> -DEXAMPLES=<a,b,...> -DPIPELINES=<a,b,...> -DPACK_SIZES=<n,m,...>
+#       -P symbol_size.cmake
+
+string(REPLACE "," ";" EXAMPLES "${EXAMPLES}")
+string(REPLACE "," ";" PIPELINES "${PIPELINES}")
+string(REPLACE "," ";" PACK_SIZES "${PACK_SIZES}")
+
+# Sets <prefix>_SYMBOLS to the number of symbols, <prefix>_NAMES to the total length of their
+# names and <prefix>_TEXT to the size of the .text sections of the file
+function(measure file prefix)
+	execute_process(COMMAND ${NM} -P ${file} OUTPUT_VARIABLE symbols RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${NM} failed on ${file}")
+	endif()
+	string(REGEX REPLACE "\n$" "" symbols "${symbols}")
+	string(REPLACE ";" "," symbols "${symbols}")
+	string(REPLACE "\n" ";" symbols "${symbols}")
+	list(LENGTH symbols count)
+	set(names 0)
+	foreach(line ${symbols})
+		string(REGEX MATCH "^[^ ]+" name "${line}")
+		string(LENGTH "${name}" length)
+		math(EXPR names "${names} + ${length}")
+	endforeach()
+
+	execute_process(COMMAND ${SIZE} -A ${file} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${SIZE} failed on ${file}")
+	endif()
+	string(REPLACE "\n" ";" sections "${sections}")
+	set(text 0)
+	foreach(line ${sections})
+		if(line MATCHES "^\\.text[^ ]* +([0-9]+)")
+			math(EXPR text "${text} + ${CMAKE_MATCH_1}")
+		endif()
+	endforeach()
+
+	set(${prefix}_SYMBOLS ${count} PARENT_SCOPE)
+	set(${prefix}_NAMES ${names} PARENT_SCOPE)
+	set(${prefix}_TEXT ${text} PARENT_SCOPE)
+endfunction()
+
+function(report label prefix)
+	message("${label}: ${${prefix}_SYMBOLS} symbols, ${${prefix}_NAMES} bytes of names, ${${prefix}_TEXT} bytes of .text")
+endfunction()
+
+foreach(example ${EXAMPLES})
+	measure(${example} example)
+	get_filename_component(name ${example} NAME)
+	report(${name} example)
+endforeach()
+
+set(first_size "")
+foreach(pipeline ${PIPELINES})
+	list(GET PACK_SIZES 0 size)
+	list(REMOVE_AT PACK_SIZES 0)
+	measure(${pipeline} pipeline)
+	report("pipeline with ${size} arguments" pipeline)
+	if(first_size STREQUAL "")
+		set(first_size ${size})
+		set(first_names ${pipeline_NAMES})
+		set(first_text ${pipeline_TEXT})
+	endif()
+endforeach()
+
+# Growing the pack by a factor must not grow the names or the code by more than the same factor
+foreach(measurement names text)
+	math(EXPR allowed "${first_${measurement}} * ${size} / ${first_size}")
+	if(pipeline_${measurement} GREATER allowed)
+		message(FATAL_ERROR "The ${measurement} of the pipeline grew from ${first_${measurement}} bytes with ${first_size} arguments to ${pipeline_${measurement}} bytes with ${size} arguments")
+	endif()
+endforeach()
@@ -0,0 +1,118 @@
+/******************************************************************//**
+ * \file   access.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_BBBB4467_ACB6_46E0_8017_835749AEBC41
+#define INCLUDE_GUARD_BBBB4467_ACB6_46E0_8017_835749AEBC41
+
+// Access to the arguments of a parameter pack or the elements of a tuple-like, and the types of them
+
+#include "vta/core.hpp"
+#include "vta/unpack.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/**************************************************************************************************
+ * Utility Functions                                                                              *
+ **************************************************************************************************/
+
+template <typename T>
+VTA_ALWAYS_INLINE constexpr T const& add_const(T&& t) noexcept {
+	return t;
+}
+
+namespace detail {
+
+template <typename T>
+struct is_nothrow_decay_copyable {
+	static bool const value = std::is_nothrow_constructible<typename std::decay<T>::type, T&&>::value;
+};
+
+}
+
+/** Calls f with the elements of the tuple-like t, keeping the value category of t. */
+template <typename Function, typename Tuple>
+VTA_ALWAYS_INLINE constexpr auto apply(Function&& f, Tuple&& t)
+  noexcept(noexcept(detail::adl::apply_helper(
+    std::forward<Function>(f),
+    std::forward<Tuple>(t),
+    std::make_index_sequence<std::tuple_size<typename std::decay<Tuple>::type>::value>{}))) {
+	typedef std::tuple_size<typename std::decay<Tuple>::type> Size;
+	return detail::adl::apply_helper(std::forward<Function>(f),
+	                                 std::forward<Tuple>(t),
+	                                 std::make_index_sequence<Size::value>{});
+}
+
+template <typename Arg, typename... Args>
+VTA_ALWAYS_INLINE constexpr auto head(Arg&& head, Args&&...) noexcept(detail::is_nothrow_decay_copyable<Arg>::value) {
+	return std::forward<Arg>(head);
+}
+
+/** The argument at position N, counting back from the end if N is negative. It is picked out of
+    the arguments with a single conversion, however far along it is. */
+template <int N, typename... Args>
+VTA_ALWAYS_INLINE constexpr auto at(Args&&... args)
+  noexcept(detail::is_nothrow_decay_copyable<
+    typename std::tuple_element<detail::modulus<N, sizeof...(Args)>::value, std::tuple<Args...>>::type>::value) {
+	constexpr int size = sizeof...(Args);
+	static_assert(-size <= N && N < size, "N is out of bounds");
+	return detail::get_ref<(N + size) % size>(
+	  detail::ref_pack<std::make_integer_sequence<int, size>, Args...>{std::forward<Args>(args)...});
+}
+
+template <typename Arg, typename... Args>
+VTA_ALWAYS_INLINE constexpr auto last(Arg&& arg, Args&&... args)
+  noexcept(detail::is_nothrow_decay_copyable<
+    typename std::tuple_element<sizeof...(Args), std::tuple<Arg, Args...>>::type>::value) {
+	return at<-1>(std::forward<Arg>(arg), std::forward<Args>(args)...);
+}
+
+/**************************************************************************************************
+ * Type Aliases                                                                                   *
+ **************************************************************************************************/
+
+template <typename... Args>
+using head_t = decltype(head(std::declval<Args>()...));
+
+template <typename... Args>
+using last_t = decltype(last(std::declval<Args>()...));
+
+template <int N>
+struct at_t {
+	template <typename... Args>
+	using type = decltype(at<N>(std::declval<Args>()...));
+};
+
+}
+
+#endif
@@ -0,0 +1,243 @@
+/******************************************************************//**
+ * \file   bits.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_A7AB2814_49BF_4376_8C2C_C5510E977C29
+#define INCLUDE_GUARD_A7AB2814_49BF_4376_8C2C_C5510E977C29
+
+// Packs parameter packs of bools into bitmasks and back
+
+#include "vta/core.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// The packing code differs with the instruction set that a translation unit is compiled for, so it is
+// put in an inline namespace named after it. Translation units built with different -m flags then get
+// symbols of their own, so that a build without AVX2 can never be linked to the AVX2 code.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VTA_PACK_ISA_BEGIN inline namespace avx2 {
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define VTA_PACK_ISA_BEGIN inline namespace sse2 {
+#else
+#define VTA_PACK_ISA_BEGIN inline namespace portable {
+#endif
+#define VTA_PACK_ISA_END }
+
+namespace vta {
+
+/** Holds N bits, as std::uint64_t when they fit and std::bitset<N> otherwise. */
+template <std::size_t N>
+using bitmask_t = typename std::conditional<(N <= 64), std::uint64_t, std::bitset<N>>::type;
+
+namespace detail {
+
+VTA_PACK_ISA_BEGIN
+
+// A bool is stored as a byte that holds 0 or 1, so an array of them can be packed a block of bytes
+// at a time. The block is packed with a byte compare and movemask where it is available.
+#if defined(__AVX2__)
+std::size_t const pack_block = 32;
+
+inline std::uint64_t pack_block_bits(bool const* values) noexcept {
+	__m256i const bytes = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values));
+	return static_cast<std::uint32_t>(~_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_setzero_si256())));
+}
+#elif defined(__SSE2__)
+std::size_t const pack_block = 16;
+
+inline std::uint64_t pack_block_bits(bool const* values) noexcept {
+	__m128i const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values));
+	return static_cast<std::uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128())));
+}
+#else
+std::size_t const pack_block = 8;
+
+inline std::uint64_t pack_block_bits(bool const* values) noexcept {
+	std::uint64_t bits = 0;
+	for(std::size_t i = 0; i < pack_block; ++i) {
+		bits |= std::uint64_t{values[i]} << i;
+	}
+	return bits;
+}
+#endif
+
+// The size of an array of N bools padded with false to whole blocks, so blocks can be loaded safely
+constexpr std::size_t padded_bools(std::size_t n) noexcept {
+	return n == 0 ? 1 : (n + pack_block - 1) / pack_block * pack_block;
+}
+
+// Packs the 64 bools starting at values + 64 * word, stopping at the block that holds the N-th
+template <std::size_t N>
+VTA_ALWAYS_INLINE std::uint64_t pack_word(bool const* values, std::size_t word) noexcept {
+	std::uint64_t bits = 0;
+	for(std::size_t i = 0; i < 64 && 64 * word + i < N; i += pack_block) {
+		bits |= pack_block_bits(values + 64 * word + i) << i;
+	}
+	return bits;
+}
+
+// Whether the call is being evaluated in a constant expression, where the movemask cannot be used.
+// Without the builtin the bools are always packed one at a time, which works in both.
+constexpr bool in_constant_expression() noexcept {
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+	return __builtin_is_constant_evaluated();
+#else
+	return true;
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+	return __builtin_is_constant_evaluated();
+#else
+	return true;
+#endif
+}
+
+// Up to 64 bools are packed a block at a time at run time, and one at a time in a constant
+// expression, so that pack_bits can give the case labels of a switch over their combinations
+template <std::size_t N>
+VTA_ALWAYS_INLINE constexpr std::uint64_t pack_bools(bool const* values, std::true_type) noexcept {
+	if(N >= 8 && !in_constant_expression()) {
+		return pack_word<N>(values, 0);
+	}
+	std::uint64_t bits = 0;
+	for(std::size_t i = 0; i < N; ++i) {
+		bits |= std::uint64_t{values[i]} << i;
+	}
+	return bits;
+}
+
+template <std::size_t N>
+VTA_ALWAYS_INLINE std::bitset<N> pack_bools(bool const* values, std::false_type) noexcept {
+	std::bitset<N> bits;
+	for(std::size_t word = (N + 63) / 64; word-- > 0;) {
+		bits <<= 64;
+		bits |= std::bitset<N>{pack_word<N>(values, word)};
+	}
+	return bits;
+}
+
+// Packs the first N bools of an array of padded_bools(N)
+template <std::size_t N>
+VTA_ALWAYS_INLINE constexpr bitmask_t<N> pack_bools(bool const* values) noexcept {
+	return pack_bools<N>(values, std::integral_constant<bool, (N <= 64)>{});
+}
+
+VTA_PACK_ISA_END
+
+// Lets the noexcept specification of mask_of_f check each call of the predicate
+struct swallow_bools {
+	template <typename... Bools>
+	constexpr swallow_bools(Bools...) noexcept {
+	}
+};
+
+// Each bit is shifted straight out of the mask into its argument, which is as cheap as depositing
+// the bits into an array of bools first with pdep and then reading them back
+template <typename Function, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr auto forward_bits(Function&& f, std::uint64_t mask, std::index_sequence<Is...>)
+  noexcept(noexcept(std::forward<Function>(f)(((mask >> Is) & 1) != 0 ...))) {
+	return std::forward<Function>(f)(((mask >> Is) & 1) != 0 ...);
+}
+
+template <typename Function, std::size_t N, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr auto forward_bits(Function&& f, std::bitset<N> const& mask, std::index_sequence<Is...>)
+  noexcept(noexcept(std::forward<Function>(f)(mask[Is]...))) {
+	return std::forward<Function>(f)(mask[Is]...);
+}
+
+}
+
+VTA_PACK_ISA_BEGIN
+
+/** Packs the bools into a bitmask, where the k-th argument is bit k. */
+template <typename... Bools>
+VTA_ALWAYS_INLINE constexpr bitmask_t<sizeof...(Bools)> pack_bits(Bools... bools) noexcept {
+	bool const values[detail::padded_bools(sizeof...(Bools))] = {static_cast<bool>(bools)...};
+	return detail::pack_bools<sizeof...(Bools)>(values);
+}
+
+VTA_PACK_ISA_END
+
+/** Calls f with the first N bits of mask as bools, where bit k is the k-th argument. */
+template <std::size_t N, typename Function>
+VTA_ALWAYS_INLINE constexpr auto unpack_bits(std::uint64_t mask, Function&& f)
+  noexcept(noexcept(detail::forward_bits(std::forward<Function>(f), mask, std::make_index_sequence<N>{}))) {
+	static_assert(N <= 64, "A std::uint64_t holds at most 64 bits, pass a std::bitset for more");
+	return detail::forward_bits(std::forward<Function>(f), mask, std::make_index_sequence<N>{});
+}
+
+template <std::size_t N, typename Function>
+VTA_ALWAYS_INLINE constexpr auto unpack_bits(std::bitset<N> const& mask, Function&& f)
+  noexcept(noexcept(detail::forward_bits(std::forward<Function>(f), mask, std::make_index_sequence<N>{}))) {
+	return detail::forward_bits(std::forward<Function>(f), mask, std::make_index_sequence<N>{});
+}
+
+VTA_PACK_ISA_BEGIN
+
+template <typename Predicate>
+class mask_of_f {
+	Predicate mF;
+
+public:
+	constexpr mask_of_f(Predicate f) noexcept(std::is_nothrow_move_constructible<Predicate>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bitmask_t<sizeof...(Args)> operator()(Args&&... args) const
+	  noexcept(noexcept(detail::swallow_bools{static_cast<bool>(mF(std::forward<Args>(args)))...})) {
+		bool const values[detail::padded_bools(sizeof...(Args))] = {static_cast<bool>(mF(std::forward<Args>(args)))...};
+		return detail::pack_bools<sizeof...(Args)>(values);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bitmask_t<sizeof...(Args)> operator()(Args&&... args)
+	  noexcept(noexcept(detail::swallow_bools{static_cast<bool>(mF(std::forward<Args>(args)))...})) {
+		bool const values[detail::padded_bools(sizeof...(Args))] = {static_cast<bool>(mF(std::forward<Args>(args)))...};
+		return detail::pack_bools<sizeof...(Args)>(values);
+	}
+};
+
+template <typename Predicate>
+constexpr mask_of_f<typename std::remove_reference<Predicate>::type> mask_of(Predicate&& f)
+  noexcept(std::is_nothrow_constructible<mask_of_f<typename std::remove_reference<Predicate>::type>,
+                                         Predicate&&>::value) {
+	return {std::forward<Predicate>(f)};
+}
+
+VTA_PACK_ISA_END
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+/******************************************************************//**
+ * \file   compare.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_F3BA6848_2119_4C97_A92D_047A47E78C23
+#define INCLUDE_GUARD_F3BA6848_2119_4C97_A92D_047A47E78C23
+
+// Compares tuple-likes element by element, with runs of integers and enumerations compared a whole word
+// at a time
+
+#include "vta/core.hpp"
+#include "vta/hash.hpp"
+#include "vta/unpack.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+namespace adl {
+
+template <std::size_t I, typename Tuple>
+VTA_ALWAYS_INLINE constexpr decltype(auto) element(Tuple const& t) noexcept(noexcept(get<I>(t))) {
+	return get<I>(t);
+}
+
+}
+
+// The number of bits that an element takes in the words that are compared in place of the elements, or
+// 0 if it is compared by itself. Only integers and enumerations of the same type on both sides are
+// packed, as their order is the order of their bits once the sign bit is flipped.
+template <typename T, typename U>
+struct ordered_width
+  : std::integral_constant<std::size_t, std::is_same<T, U>::value && (std::is_integral<T>::value || std::is_enum<T>::value)
+                                        ? sizeof(T) * 8
+                                        : 0> {
+};
+
+template <std::size_t... Widths>
+struct order_layout {
+	static constexpr std::size_t count = sizeof...(Widths);
+
+	// Padded with an element that is not packed, so that every run of packed elements has an end
+	static constexpr std::size_t widths[] = {Widths..., 0};
+
+	// The bit at which the element at index starts, counted from the most significant bit of the first
+	// word. Packed elements follow each other bit by bit, but one that would straddle two words starts
+	// the next word instead, so that it is put in with a single shift. An element that is not packed
+	// ends the run, so that the next one starts a new word too.
+	constexpr static std::size_t bit(std::size_t index) noexcept {
+		std::size_t bit = 0;
+		for(std::size_t i = 0;; ++i) {
+			if(widths[i] == 0 || bit % 64 + widths[i] > 64) {
+				bit = (bit + 63) / 64 * 64;
+			}
+			if(i == index) {
+				return bit;
+			}
+			bit += widths[i];
+		}
+	}
+
+	// Whether the element at index is the last one in its word, which can then be compared
+	constexpr static bool ends_word(std::size_t index) noexcept {
+		return widths[index] != 0 && (widths[index + 1] == 0 || bit(index + 1) / 64 != bit(index) / 64);
+	}
+
+	static constexpr std::size_t words = bit(count) / 64;
+};
+
+template <std::size_t... Widths>
+constexpr std::size_t order_layout<Widths...>::count;
+
+template <std::size_t... Widths>
+constexpr std::size_t order_layout<Widths...>::widths[];
+
+template <std::size_t... Widths>
+constexpr std::size_t order_layout<Widths...>::words;
+
+constexpr std::uint64_t ordered_bits(bool value) noexcept {
+	return value ? 1 : 0;
+}
+
+// Flipping the sign bit maps the most negative value to 0 and the most positive to the largest
+// unsigned value, so that signed values compare in the same order as their bits
+template <typename T>
+constexpr std::enable_if_t<std::is_integral<T>::value, std::uint64_t> ordered_bits(T value) noexcept {
+	return static_cast<std::make_unsigned_t<T>>(value)
+	     ^ (std::is_signed<T>::value ? std::uint64_t{1} << (sizeof(T) * 8 - 1) : 0);
+}
+
+template <typename T>
+constexpr std::enable_if_t<std::is_enum<T>::value, std::uint64_t> ordered_bits(T value) noexcept {
+	return ordered_bits(static_cast<std::underlying_type_t<T>>(value));
+}
+
+// Puts the Width bits of value at Bit, counted from the most significant bit of its word
+template <std::size_t Bit, std::size_t Width>
+VTA_ALWAYS_INLINE constexpr void put_ordered(std::uint64_t* words, std::uint64_t value) noexcept {
+	words[Bit / 64] |= value << (64 - Bit % 64 - Width);
+}
+
+// Only operator< is needed, as for the operators of std::tuple, apart from strings, which are compared
+// once instead of twice
+template <typename T, typename U>
+constexpr int compare_values(T const& lhs, U const& rhs) {
+	return lhs < rhs ? -1 : rhs < lhs ? 1 : 0;
+}
+
+template <typename Char, typename Traits, typename Allocator>
+int compare_values(std::basic_string<Char, Traits, Allocator> const& lhs,
+                   std::basic_string<Char, Traits, Allocator> const& rhs) noexcept {
+	int const result = lhs.compare(rhs);
+	return result < 0 ? -1 : result > 0 ? 1 : 0;
+}
+
+// Packs the element into its word, and compares the word once the last element in it is there, so
+// that the elements in later words are not read when it differs
+template <typename Layout, std::size_t I, typename T>
+VTA_ALWAYS_INLINE constexpr void compare_element(int& result, std::uint64_t* lhs_words, std::uint64_t* rhs_words,
+                                                 T const& lhs, T const& rhs, std::true_type) noexcept {
+	if(result != 0) {
+		return;
+	}
+	std::size_t const word = Layout::bit(I) / 64;
+	put_ordered<Layout::bit(I), Layout::widths[I]>(lhs_words, ordered_bits(lhs));
+	put_ordered<Layout::bit(I), Layout::widths[I]>(rhs_words, ordered_bits(rhs));
+	if(Layout::ends_word(I) && lhs_words[word] != rhs_words[word]) {
+		result = lhs_words[word] < rhs_words[word] ? -1 : 1;
+	}
+}
+
+template <typename Layout, std::size_t I, typename T, typename U>
+VTA_ALWAYS_INLINE constexpr void compare_element(int& result, std::uint64_t*, std::uint64_t*,
+                                                 T const& lhs, U const& rhs, std::false_type) {
+	if(result == 0) {
+		result = compare_values(lhs, rhs);
+	}
+}
+
+template <typename TupleA, typename TupleB, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr int compare_tuples(TupleA const& lhs, TupleB const& rhs, std::index_sequence<Is...>) {
+	typedef order_layout<ordered_width<std::decay_t<std::tuple_element_t<Is, TupleA>>,
+	                                   std::decay_t<std::tuple_element_t<Is, TupleB>>>::value...> layout;
+	std::uint64_t lhs_words[layout::words + 1] = {};
+	std::uint64_t rhs_words[layout::words + 1] = {};
+	static_cast<void>(lhs_words);
+	static_cast<void>(rhs_words);
+	int result = 0;
+	swallow{0, (compare_element<layout, Is>(result, lhs_words, rhs_words, adl::element<Is>(lhs), adl::element<Is>(rhs),
+	                                        std::integral_constant<bool, layout::widths[Is] != 0>{}), 0)...};
+	return result;
+}
+
+// Elements of the same type that are contiguously hashable are equal exactly when their bits are, so
+// they are compared the same way as they are hashed: integers, enumerations and pointers are xored
+// together and other types with memcmp
+template <typename T, typename U>
+struct equal_kind_of
+  : std::integral_constant<hash_kind, std::is_same<T, U>::value ? hash_kind_of<T>::value : hash_kind::fallback> {
+};
+
+template <typename T>
+VTA_ALWAYS_INLINE constexpr void differ_element(std::uint64_t& difference, T const& lhs, T const& rhs,
+                                                std::integral_constant<hash_kind, hash_kind::packed>) noexcept {
+	difference |= scalar_bits(lhs) ^ scalar_bits(rhs);
+}
+
+template <typename T>
+VTA_ALWAYS_INLINE void differ_element(std::uint64_t& difference, T const& lhs, T const& rhs,
+                                      std::integral_constant<hash_kind, hash_kind::copied>) noexcept {
+	static_assert(std::is_trivially_copyable<T>::value, "A contiguously hashable type must be trivially copyable");
+	difference |= std::memcmp(&lhs, &rhs, sizeof(T)) != 0;
+}
+
+template <typename T, typename U>
+VTA_ALWAYS_INLINE constexpr void differ_element(std::uint64_t&, T const&, U const&,
+                                                std::integral_constant<hash_kind, hash_kind::fallback>) noexcept {
+}
+
+template <typename T, typename U, hash_kind Kind>
+VTA_ALWAYS_INLINE constexpr void equal_element(bool&, T const&, U const&, std::integral_constant<hash_kind, Kind>) noexcept {
+}
+
+template <typename T, typename U>
+VTA_ALWAYS_INLINE constexpr void equal_element(bool& result, T const& lhs, U const& rhs,
+                                               std::integral_constant<hash_kind, hash_kind::fallback>) {
+	result = result && lhs == rhs;
+}
+
+// The elements that can be compared by their bits are compared first, all together and without a
+// branch, and then the rest in order until one differs
+template <typename TupleA, typename TupleB, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr bool equal_tuples(TupleA const& lhs, TupleB const& rhs, std::index_sequence<Is...>) {
+	std::uint64_t difference = 0;
+	swallow{0, (differ_element(difference, adl::element<Is>(lhs), adl::element<Is>(rhs),
+	                           equal_kind_of<std::decay_t<std::tuple_element_t<Is, TupleA>>,
+	                                         std::decay_t<std::tuple_element_t<Is, TupleB>>>{}), 0)...};
+	if(difference != 0) {
+		return false;
+	}
+	bool result = true;
+	swallow{0, (equal_element(result, adl::element<Is>(lhs), adl::element<Is>(rhs),
+	                          equal_kind_of<std::decay_t<std::tuple_element_t<Is, TupleA>>,
+	                                        std::decay_t<std::tuple_element_t<Is, TupleB>>>{}), 0)...};
+	return result;
+}
+
+template <typename TupleA, typename TupleB>
+using checked_indices = std::enable_if_t<std::tuple_size<TupleA>::value == std::tuple_size<TupleB>::value,
+                                         tuple_indices<TupleA>>;
+
+}
+
+/** Compares two tuple-likes of the same size lexicographically, and returns -1, 0 or 1 as lhs is less
+    than, equivalent to or greater than rhs. */
+struct compare_f {
+	template <typename TupleA, typename TupleB>
+	VTA_ALWAYS_INLINE constexpr int operator()(TupleA const& lhs, TupleB const& rhs) const {
+		return detail::compare_tuples(lhs, rhs, detail::checked_indices<TupleA, TupleB>{});
+	}
+};
+
+/** Whether each element of lhs is equal to the element of rhs at the same position. */
+struct equal_f {
+	template <typename TupleA, typename TupleB>
+	VTA_ALWAYS_INLINE constexpr bool operator()(TupleA const& lhs, TupleB const& rhs) const {
+		return detail::equal_tuples(lhs, rhs, detail::checked_indices<TupleA, TupleB>{});
+	}
+};
+
+template <typename TupleA, typename TupleB>
+VTA_ALWAYS_INLINE constexpr int compare(TupleA const& lhs, TupleB const& rhs) {
+	return compare_f{}(lhs, rhs);
+}
+
+template <typename TupleA, typename TupleB>
+VTA_ALWAYS_INLINE constexpr bool equal(TupleA const& lhs, TupleB const& rhs) {
+	return equal_f{}(lhs, rhs);
+}
+
+}
+
+#endif
@@ -0,0 +1,212 @@
+/******************************************************************//**
+ * \file   concat.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_D9D7E94A_EE87_420C_9B5A_477699642632
+#define INCLUDE_GUARD_D9D7E94A_EE87_420C_9B5A_477699642632
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+template <typename T, typename = void>
+struct concat_piece {
+	static_assert(sizeof(T) == 0, "Type cannot be passed to concat or append");
+};
+
+template <>
+struct concat_piece<char> {
+	constexpr static std::size_t max_width(char) noexcept {
+		return 1;
+	}
+
+	static std::size_t write(char* out, char c, std::size_t) noexcept {
+		*out = c;
+		return 1;
+	}
+};
+
+template <>
+struct concat_piece<signed char> : concat_piece<char> {};
+
+template <>
+struct concat_piece<unsigned char> : concat_piece<char> {};
+
+// String literals have a length known at compile time, but as any char array can be passed we only
+// use it as an upper bound and stop at the first null character
+template <std::size_t N>
+struct concat_piece<char[N]> {
+	constexpr static std::size_t max_width(char const (&)[N]) noexcept {
+		return N - 1;
+	}
+
+	static std::size_t write(char* out, char const (&str)[N], std::size_t) noexcept {
+		std::size_t const length = std::find(str, str + N - 1, '\0') - str;
+		std::memcpy(out, str, length);
+		return length;
+	}
+};
+
+template <>
+struct concat_piece<char const*> {
+	static std::size_t max_width(char const* str) noexcept {
+		return std::strlen(str);
+	}
+
+	// The width is the exact length calculated by max_width, so we do not need to search again
+	static std::size_t write(char* out, char const* str, std::size_t width) noexcept {
+		std::memcpy(out, str, width);
+		return width;
+	}
+};
+
+template <>
+struct concat_piece<char*> : concat_piece<char const*> {};
+
+// std::string, std::string_view and any other contiguous range of char
+template <typename T>
+struct concat_piece<T, typename std::enable_if<std::is_same<
+  typename std::remove_cv<typename std::remove_pointer<decltype(std::declval<T const&>().data())>::type>::type,
+  char
+>::value && (sizeof(std::declval<T const&>().size()) > 0)>::type> {
+	static std::size_t max_width(T const& str) noexcept {
+		return str.size();
+	}
+
+	static std::size_t write(char* out, T const& str, std::size_t width) noexcept {
+		std::memcpy(out, str.data(), width);
+		return width;
+	}
+};
+
+template <typename T>
+struct concat_piece<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+	// digits10 is the number of digits that can always be represented, so there may be one more
+	// digit as well as a sign
+	constexpr static std::size_t max_width(T) noexcept {
+		return std::numeric_limits<T>::digits10 + 2;
+	}
+
+	static std::size_t write(char* out, T value, std::size_t) noexcept {
+		char digits[std::numeric_limits<unsigned long long>::digits10 + 2];
+		char* const end = digits + sizeof(digits);
+		char* begin = end;
+		bool const negative = is_negative(value, std::is_signed<T>{});
+		unsigned long long magnitude = static_cast<unsigned long long>(value);
+		if(negative) {
+			magnitude = 0ull - magnitude;
+		}
+
+		do {
+			*--begin = static_cast<char>('0' + magnitude % 10);
+			magnitude /= 10;
+		} while(magnitude != 0);
+
+		if(negative) {
+			*--begin = '-';
+		}
+
+		std::memcpy(out, begin, end - begin);
+		return end - begin;
+	}
+
+private:
+	constexpr static bool is_negative(T value, std::true_type) noexcept {
+		return value < 0;
+	}
+
+	constexpr static bool is_negative(T, std::false_type) noexcept {
+		return false;
+	}
+};
+
+// Floating point numbers are written in the same format as std::ostream with its default settings
+template <typename T>
+struct concat_piece<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+	// Sign, 6 significant digits, decimal point and up to a 4 digit exponent, e.g. "-1.23457e-4932"
+	constexpr static std::size_t max_width(T) noexcept {
+		return 16;
+	}
+
+	static std::size_t write(char* out, T value, std::size_t width) noexcept {
+		return std::snprintf(out, width + 1, "%Lg", static_cast<long double>(value));
+	}
+};
+
+template <typename Arg>
+using concat_piece_t = concat_piece<typename std::remove_cv<typename std::remove_reference<Arg>::type>::type>;
+
+template <typename String>
+constexpr std::size_t write_pieces(String&, std::size_t position, std::size_t const*) noexcept {
+	return position;
+}
+
+template <typename String, typename Arg, typename... Args>
+std::size_t write_pieces(String& out, std::size_t position, std::size_t const* widths, Arg const& arg, Args const&... args) {
+	position += concat_piece_t<Arg>::write(&out[position], arg, *widths);
+	return write_pieces(out, position, widths + 1, args...);
+}
+
+}
+
+/** Appends all of args to out, allocating at most once. */
+template <typename Traits, typename Allocator, typename... Args>
+std::basic_string<char, Traits, Allocator>& append(std::basic_string<char, Traits, Allocator>& out, Args const&... args) {
+	std::size_t const widths[] = {detail::concat_piece_t<Args>::max_width(args)..., 0};
+	std::size_t total = 0;
+	for(std::size_t width : widths) {
+		total += width;
+	}
+
+	// Size the string once for the widest possible output, then trim it to what was written
+	std::size_t const start = out.size();
+	out.resize(start + total);
+	out.resize(detail::write_pieces(out, start, widths, args...));
+	return out;
+}
+
+/** Returns a string of all of args appended together. */
+template <typename... Args>
+std::string concat(Args const&... args) {
+	std::string str;
+	append(str, args...);
+	return str;
+}
+
+}
+
+#endif
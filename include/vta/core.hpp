@@ -0,0 +1,141 @@
+/******************************************************************//**
+ * \file   core.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_2AD889A6_07C5_4DA8_A1EC_F1E4EC0A2480
+#define INCLUDE_GUARD_2AD889A6_07C5_4DA8_A1EC_F1E4EC0A2480
+
+// The macros and helpers that every component header of VTA shares
+
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+// Returns the size of the parameter pack as an integer
+template <typename... Args>
+constexpr int count(Args&&...) noexcept {
+	return sizeof...(Args);
+}
+
+/**************************************************************************************************
+ * Macro                                                                                          *
+ **************************************************************************************************/
+
+// Provided by Florian Weber (http://florianjw.de/en/passing_overloaded_functions.html)
+#define VTA_FN_TO_FUNCTOR(...) [](auto&&... args) \
+  -> decltype(auto){ return __VA_ARGS__(std::forward<decltype(args)>(args)...); }
+
+// Marks a pointer as not aliasing any other pointer accessed in the same scope
+#define VTA_RESTRICT __restrict
+
+// Asks the compiler to unroll the loop that follows
+#if defined(__clang__)
+#define VTA_UNROLL _Pragma("clang loop unroll_count(4)")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define VTA_UNROLL _Pragma("GCC unroll 4")
+#else
+#define VTA_UNROLL
+#endif
+
+// Forces the adaptors and transformations to be inlined, so that they leave no calls behind even in
+// unoptimised builds. Define VTA_FLATTEN as 0 to keep them as real calls that can be stepped into.
+#ifndef VTA_FLATTEN
+#define VTA_FLATTEN 1
+#endif
+
+#if VTA_FLATTEN && (defined(__GNUC__) || defined(__clang__))
+#define VTA_ALWAYS_INLINE __attribute__((always_inline)) inline
+#elif VTA_FLATTEN && defined(_MSC_VER)
+#define VTA_ALWAYS_INLINE __forceinline
+#else
+#define VTA_ALWAYS_INLINE inline
+#endif
+
+// Define VTA_INSTRUMENT as 1 to have the adaptors report each call to the sink set with
+// vta::set_probe_sink, which stops them from being used in constant expressions
+#ifndef VTA_INSTRUMENT
+#define VTA_INSTRUMENT 0
+#endif
+
+// The definitions that send probes are put in an inline namespace of their own when VTA_INSTRUMENT is
+// 1, so that translation units that disagree on it use adaptors with different symbols instead of
+// whichever definition the linker keeps
+#if VTA_INSTRUMENT
+#define VTA_PROBE(name, pack_size) ::vta::detail::probe_scope const vta_probe{name, pack_size}
+#define VTA_INSTRUMENTED_BEGIN inline namespace instrumented {
+#define VTA_INSTRUMENTED_END }
+#else
+#define VTA_PROBE(name, pack_size) static_cast<void>(0)
+#define VTA_INSTRUMENTED_BEGIN
+#define VTA_INSTRUMENTED_END
+#endif
+
+namespace detail {
+
+template <int N, int Modulus>
+struct modulus {
+	static int const value = (N + Modulus) % Modulus;
+};
+
+// Holds a reference to each argument, each in a base of its own so that one is found by its index
+// with a single conversion rather than the recursion std::get goes through
+template <int I, typename T>
+struct ref_leaf {
+	T&& ref;
+};
+
+template <typename Indices, typename... Args>
+struct ref_pack;
+
+template <int... Is, typename... Args>
+struct ref_pack<std::integer_sequence<int, Is...>, Args...> : ref_leaf<Is, Args>... {
+	VTA_ALWAYS_INLINE constexpr ref_pack(Args&&... args) noexcept
+	: ref_leaf<Is, Args>{std::forward<Args>(args)}... {
+	}
+};
+
+template <int I, typename T>
+VTA_ALWAYS_INLINE constexpr T&& get_ref(ref_leaf<I, T> const& leaf) noexcept {
+	return std::forward<T>(leaf.ref);
+}
+
+template <int I, typename T>
+VTA_ALWAYS_INLINE constexpr typename std::remove_reference<T>::type& get_lvalue(ref_leaf<I, T> const& leaf) noexcept {
+	return leaf.ref;
+}
+
+}
+
+}
+
+#if VTA_INSTRUMENT
+#include "vta/instrument.hpp"
+#endif
+
+#endif
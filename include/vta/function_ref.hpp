@@ -0,0 +1,116 @@
+/******************************************************************//**
+ * \file   function_ref.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_0C77F982_1D79_4012_BE86_EF7E69787F6D
+#define INCLUDE_GUARD_0C77F982_1D79_4012_BE86_EF7E69787F6D
+
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+template <typename Signature>
+class function_ref;
+
+namespace detail {
+
+template <typename Result, typename Function, typename Args, typename = void>
+struct is_invocable_r : std::false_type {};
+
+template <typename Result, typename Function, typename... Args>
+struct is_invocable_r<Result,
+                      Function,
+                      void(Args...),
+                      decltype(static_cast<void>(std::declval<Function>()(std::declval<Args>()...)))>
+  : std::integral_constant<bool,
+                           std::is_void<Result>::value
+                           || std::is_convertible<decltype(std::declval<Function>()(std::declval<Args>()...)),
+                                                  Result>::value> {};
+
+template <typename T>
+struct is_function_ref : std::false_type {};
+
+template <typename Signature>
+struct is_function_ref<function_ref<Signature>> : std::true_type {};
+
+}
+
+/** A non-owning reference to any callable with the signature Result(Args...). Passing it to an
+    adaptor instead of a lambda shares one instantiation of the adaptor between every callable with
+    the same signature, at the cost of an indirect call for each argument. */
+template <typename Result, typename... Args>
+class function_ref<Result(Args...)> {
+	// Functions cannot be pointed to by a void*, so they are stored as a function pointer instead
+	union storage {
+		void* object;
+		void (*function)();
+	};
+
+	storage mCallable;
+	Result (*mCall)(storage, Args&&...);
+
+	template <typename Function>
+	static Result call_object(storage callable, Args&&... args) {
+		return static_cast<Result>((*static_cast<Function*>(callable.object))(std::forward<Args>(args)...));
+	}
+
+	template <typename Function>
+	static Result call_function(storage callable, Args&&... args) {
+		return static_cast<Result>(reinterpret_cast<Function*>(callable.function)(std::forward<Args>(args)...));
+	}
+
+public:
+	/** Refers to f, which must outlive the function_ref. */
+	template <typename Function,
+	          typename Decayed = typename std::decay<Function>::type,
+	          typename std::enable_if<!detail::is_function_ref<Decayed>::value
+	                                  && !std::is_function<typename std::remove_pointer<Decayed>::type>::value
+	                                  && detail::is_invocable_r<Result, Function&, void(Args...)>::value>::type* = nullptr>
+	function_ref(Function&& f) noexcept
+	: mCall(&call_object<typename std::remove_reference<Function>::type>) {
+		mCallable.object = const_cast<void*>(static_cast<void const volatile*>(&reinterpret_cast<char const volatile&>(f)));
+	}
+
+	/** Refers to the function f points to, so that f itself may be a temporary. */
+	template <typename Function,
+	          typename std::enable_if<std::is_function<Function>::value
+	                                  && detail::is_invocable_r<Result, Function*, void(Args...)>::value>::type* = nullptr>
+	function_ref(Function* f) noexcept
+	: mCall(&call_function<Function>) {
+		mCallable.function = reinterpret_cast<void (*)()>(f);
+	}
+
+	Result operator()(Args... args) const {
+		return mCall(mCallable, std::forward<Args>(args)...);
+	}
+};
+
+}
+
+#endif
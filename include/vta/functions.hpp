@@ -0,0 +1,724 @@
+/******************************************************************//**
+ * \file   functions.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_CFDFB43F_F91A_490F_8535_0ED9633BAB3C
+#define INCLUDE_GUARD_CFDFB43F_F91A_490F_8535_0ED9633BAB3C
+
+// Functors that apply a function across every argument of a parameter pack
+
+#include "vta/core.hpp"
+#include "vta/transformations.hpp"
+#include "vta/unpack.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Only the assertion that batch's columns do not overlap needs std::less, so builds without asserts do
+// not pay for parsing <functional>
+#ifndef NDEBUG
+#include <functional>
+#endif
+
+namespace vta {
+
+/**************************************************************************************************
+ * Functions                                                                                      *
+ **************************************************************************************************/
+
+namespace detail {
+
+// Expanding a pack into the braces of swallow{0, (expr, 0)...} evaluates expr for each argument in
+// order, without the recursive call per argument that would be left behind in unoptimised builds
+struct swallow {
+	template <typename... Ts>
+	VTA_ALWAYS_INLINE constexpr swallow(Ts&&...) noexcept {
+	}
+};
+
+// Sets result to f(arg) unless it already holds Stop, which gives all_of, any_of and none_of their
+// short-circuiting when they are expanded with swallow
+template <bool Stop, typename Function, typename Arg>
+VTA_ALWAYS_INLINE constexpr int test_unless(bool& result, Function& f, Arg&& arg)
+  noexcept(noexcept(static_cast<bool>(f(std::forward<Arg>(arg))))) {
+	if(result != Stop) {
+		result = static_cast<bool>(f(std::forward<Arg>(arg)));
+	}
+	return 0;
+}
+
+}
+
+VTA_INSTRUMENTED_BEGIN
+
+template <typename Function>
+class map_f {
+	Function mF;
+
+public:
+	constexpr map_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr void operator()(Args&&... args) const
+	  noexcept(noexcept(detail::swallow{0, (static_cast<void>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::map", sizeof...(Args));
+		detail::swallow{0, (static_cast<void>(mF(std::forward<Args>(args))), 0)...};
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr void operator()(Args&&... args)
+	  noexcept(noexcept(detail::swallow{0, (static_cast<void>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::map", sizeof...(Args));
+		detail::swallow{0, (static_cast<void>(mF(std::forward<Args>(args))), 0)...};
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr void operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr void operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Function>
+constexpr map_f<typename std::remove_reference<Function>::type> map(Function&& f)
+  noexcept(std::is_nothrow_constructible<map_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+VTA_INSTRUMENTED_END
+
+namespace detail {
+
+// Calls f with the arguments of pack at Start + Ks..., forwarding the first of them as no later window
+// uses it and passing the others as lvalues
+template <int Start, int... Ks, typename Function, typename Pack>
+VTA_ALWAYS_INLINE constexpr int call_window(Function& f, Pack const& pack, std::integer_sequence<int, 0, Ks...>)
+  noexcept(noexcept(f(get_ref<Start>(pack), get_lvalue<Start + Ks>(pack)...))) {
+	f(get_ref<Start>(pack), get_lvalue<Start + Ks>(pack)...);
+	return 0;
+}
+
+// Calls f on each window in turn, expanding the windows with swallow rather than recursing once per
+// argument
+template <int... Starts, typename Function, typename Pack, typename Window>
+VTA_ALWAYS_INLINE constexpr void call_windows(Function& f, Pack const& pack, std::integer_sequence<int, Starts...>, Window w)
+  noexcept(noexcept(swallow{0, call_window<Starts>(f, pack, w)...})) {
+	swallow{0, call_window<Starts>(f, pack, w)...};
+}
+
+template <unsigned N, typename... Args>
+using window_starts = std::make_integer_sequence<int, (sizeof...(Args) >= N ? sizeof...(Args) - N + 1 : 0)>;
+
+}
+
+template <unsigned N, typename Function>
+class adjacent_map_f {
+	Function mF;
+
+	template <typename F, typename... Args>
+	using windows_are_nothrow = std::integral_constant<bool, noexcept(detail::call_windows(
+	  std::declval<F&>(),
+	  std::declval<detail::ref_pack<std::make_integer_sequence<int, sizeof...(Args)>, Args...> const&>(),
+	  detail::window_starts<N, Args...>{},
+	  std::make_integer_sequence<int, N>{}))>;
+
+public:
+	constexpr adjacent_map_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename First, typename... Args>
+	VTA_ALWAYS_INLINE constexpr void operator()(First&& first, Args&&... args) const
+	  noexcept(windows_are_nothrow<Function const, First, Args...>::value) {
+		static_assert(0 < N && N <= sizeof...(Args) + 1, "N must be between 1 and the number of arguments");
+		detail::call_windows(mF,
+		                     detail::ref_pack<std::make_integer_sequence<int, sizeof...(Args) + 1>, First, Args...>{
+		                       std::forward<First>(first), std::forward<Args>(args)...},
+		                     detail::window_starts<N, First, Args...>{},
+		                     std::make_integer_sequence<int, N>{});
+	}
+
+	template <typename First, typename... Args>
+	VTA_ALWAYS_INLINE constexpr void operator()(First&& first, Args&&... args)
+	  noexcept(windows_are_nothrow<Function, First, Args...>::value) {
+		static_assert(0 < N && N <= sizeof...(Args) + 1, "N must be between 1 and the number of arguments");
+		detail::call_windows(mF,
+		                     detail::ref_pack<std::make_integer_sequence<int, sizeof...(Args) + 1>, First, Args...>{
+		                       std::forward<First>(first), std::forward<Args>(args)...},
+		                     detail::window_starts<N, First, Args...>{},
+		                     std::make_integer_sequence<int, N>{});
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr void operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr void operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <unsigned N, typename Function>
+constexpr adjacent_map_f<N, typename std::remove_reference<Function>::type> adjacent_map(Function&& f)
+  noexcept(std::is_nothrow_constructible<adjacent_map_f<N, typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+VTA_INSTRUMENTED_BEGIN
+
+template <typename Function>
+class foldl_f {
+	Function mF;
+
+public:
+	constexpr foldl_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(First&& first, Second&& second, Args&&... args) const
+	  noexcept(noexcept(fold(mF, std::forward<First>(first), std::forward<Second>(second),
+	                         std::forward<Args>(args)...))) {
+		VTA_PROBE("vta::foldl", 2 + sizeof...(Args));
+		return fold(mF, std::forward<First>(first), std::forward<Second>(second),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(First&& first, Second&& second, Args&&... args)
+	  noexcept(noexcept(fold(mF, std::forward<First>(first), std::forward<Second>(second),
+	                         std::forward<Args>(args)...))) {
+		VTA_PROBE("vta::foldl", 2 + sizeof...(Args));
+		return fold(mF, std::forward<First>(first), std::forward<Second>(second),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+private:
+	// The recursion goes through fold rather than operator() so that an instrumented fold reports
+	// once per call instead of once per step. Four steps are taken at each level, which cuts the
+	// nesting that an unoptimised build has to go through by as much.
+	template <typename F, typename A, typename B, typename C, typename D, typename E, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto fold(F& f, A&& a, B&& b, C&& c, D&& d, E&& e, Args&&... args)
+	  noexcept(noexcept(fold(f, f(f(f(f(std::forward<A>(a), std::forward<B>(b)), std::forward<C>(c)),
+	                                std::forward<D>(d)),
+	                              std::forward<E>(e)),
+	                         std::forward<Args>(args)...))) {
+		return fold(f, f(f(f(f(std::forward<A>(a), std::forward<B>(b)), std::forward<C>(c)), std::forward<D>(d)),
+		                 std::forward<E>(e)),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename F, typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto fold(F& f, First&& first, Second&& second, Args&&... args)
+	  noexcept(noexcept(fold(f, f(std::forward<First>(first), std::forward<Second>(second)),
+	                         std::forward<Args>(args)...))) {
+		return fold(f, f(std::forward<First>(first), std::forward<Second>(second)),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename F, typename Arg>
+	VTA_ALWAYS_INLINE constexpr static Arg fold(F&, Arg&& arg) noexcept(std::is_nothrow_constructible<Arg, Arg&&>::value) {
+		return std::forward<Arg>(arg);
+	}
+};
+
+template <typename Function>
+constexpr foldl_f<typename std::remove_reference<Function>::type> foldl(Function&& f)
+  noexcept(std::is_nothrow_constructible<foldl_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+template <typename Function>
+class foldr_f {
+	Function mF;
+
+public:
+	constexpr foldr_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(First&& first, Second&& second, Args&&... args) const
+	  noexcept(noexcept(fold(mF, std::forward<First>(first), std::forward<Second>(second),
+	                         std::forward<Args>(args)...))) {
+		VTA_PROBE("vta::foldr", 2 + sizeof...(Args));
+		return fold(mF, std::forward<First>(first), std::forward<Second>(second),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(First&& first, Second&& second, Args&&... args)
+	  noexcept(noexcept(fold(mF, std::forward<First>(first), std::forward<Second>(second),
+	                         std::forward<Args>(args)...))) {
+		VTA_PROBE("vta::foldr", 2 + sizeof...(Args));
+		return fold(mF, std::forward<First>(first), std::forward<Second>(second),
+		            std::forward<Args>(args)...);
+	}
+
+	template <typename Arg>
+	VTA_ALWAYS_INLINE constexpr Arg operator()(Arg&& arg) const noexcept(std::is_nothrow_constructible<Arg, Arg&&>::value) {
+		VTA_PROBE("vta::foldr", 1);
+		return std::forward<Arg>(arg);
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+private:
+	// See foldl_f::fold
+	template <typename F, typename A, typename B, typename C, typename D, typename E, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto fold(F& f, A&& a, B&& b, C&& c, D&& d, E&& e, Args&&... args)
+	  noexcept(noexcept(f(std::forward<A>(a),
+	                      f(std::forward<B>(b),
+	                        f(std::forward<C>(c),
+	                          f(std::forward<D>(d), fold(f, std::forward<E>(e), std::forward<Args>(args)...))))))) {
+		return f(std::forward<A>(a),
+		         f(std::forward<B>(b),
+		           f(std::forward<C>(c), f(std::forward<D>(d), fold(f, std::forward<E>(e), std::forward<Args>(args)...)))));
+	}
+
+	template <typename F, typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto fold(F& f, First&& first, Second&& second, Args&&... args)
+	  noexcept(noexcept(f(std::forward<First>(first),
+	                      fold(f, std::forward<Second>(second), std::forward<Args>(args)...)))) {
+		return f(std::forward<First>(first),
+		         fold(f, std::forward<Second>(second), std::forward<Args>(args)...));
+	}
+
+	template <typename F, typename Arg>
+	VTA_ALWAYS_INLINE constexpr static Arg fold(F&, Arg&& arg) noexcept(std::is_nothrow_constructible<Arg, Arg&&>::value) {
+		return std::forward<Arg>(arg);
+	}
+};
+
+template <typename Function>
+constexpr foldr_f<typename std::remove_reference<Function>::type> foldr(Function&& f)
+  noexcept(std::is_nothrow_constructible<foldr_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+VTA_INSTRUMENTED_END
+
+namespace detail {
+
+struct no_size_hint {};
+
+struct sum_sizes {
+	constexpr std::size_t operator()(std::size_t lhs, std::size_t rhs) const noexcept {
+		return lhs + rhs;
+	}
+};
+
+template <typename Accumulator>
+VTA_ALWAYS_INLINE constexpr auto reserve(Accumulator& acc, std::size_t n, int) noexcept(noexcept(acc.reserve(acc.size() + n)))
+  -> decltype(acc.reserve(acc.size() + n)) {
+	return acc.reserve(acc.size() + n);
+}
+
+template <typename Accumulator>
+VTA_ALWAYS_INLINE constexpr void reserve(Accumulator&, std::size_t, long) noexcept {
+}
+
+template <typename Accumulator, typename SizeHint, typename... Args>
+VTA_ALWAYS_INLINE constexpr void reserve_for(Accumulator& acc, SizeHint const& size_hint, Args const&... args)
+  noexcept(noexcept(reserve(acc, foldl(sum_sizes{})(std::size_t{0}, static_cast<std::size_t>(size_hint(args))...), 0))) {
+	reserve(acc, foldl(sum_sizes{})(std::size_t{0}, static_cast<std::size_t>(size_hint(args))...), 0);
+}
+
+template <typename Accumulator, typename... Args>
+VTA_ALWAYS_INLINE constexpr void reserve_for(Accumulator&, no_size_hint const&, Args const&...) noexcept {
+}
+
+}
+
+template <typename Accumulator, typename Function, typename SizeHint>
+class accumulate_into_f {
+	Accumulator* mAcc;
+	Function mF;
+	SizeHint mSizeHint;
+
+public:
+	constexpr accumulate_into_f(Accumulator& acc, Function f, SizeHint size_hint)
+	  noexcept(std::is_nothrow_move_constructible<Function>::value
+	           && std::is_nothrow_move_constructible<SizeHint>::value)
+	: mAcc(&acc)
+	, mF(std::move(f))
+	, mSizeHint(std::move(size_hint)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr Accumulator& operator()(Args&&... args) const
+	  noexcept(noexcept(detail::reserve_for(*mAcc, mSizeHint, args...))
+	           && noexcept(detail::swallow{0, (static_cast<void>(mF(*mAcc, std::forward<Args>(args))), 0)...})) {
+		detail::reserve_for(*mAcc, mSizeHint, args...);
+		detail::swallow{0, (static_cast<void>(mF(*mAcc, std::forward<Args>(args))), 0)...};
+		return *mAcc;
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr Accumulator& operator()(Args&&... args)
+	  noexcept(noexcept(detail::reserve_for(*mAcc, mSizeHint, args...))
+	           && noexcept(detail::swallow{0, (static_cast<void>(mF(*mAcc, std::forward<Args>(args))), 0)...})) {
+		detail::reserve_for(*mAcc, mSizeHint, args...);
+		detail::swallow{0, (static_cast<void>(mF(*mAcc, std::forward<Args>(args))), 0)...};
+		return *mAcc;
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr Accumulator& operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr Accumulator& operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Accumulator, typename Function>
+constexpr accumulate_into_f<Accumulator,
+                            typename std::remove_reference<Function>::type,
+                            detail::no_size_hint>
+accumulate_into(Accumulator& acc, Function&& f)
+  noexcept(std::is_nothrow_constructible<typename std::remove_reference<Function>::type, Function&&>::value
+           && std::is_nothrow_move_constructible<typename std::remove_reference<Function>::type>::value) {
+	return {acc, std::forward<Function>(f), detail::no_size_hint{}};
+}
+
+template <typename Accumulator, typename Function, typename SizeHint>
+constexpr accumulate_into_f<Accumulator,
+                            typename std::remove_reference<Function>::type,
+                            typename std::remove_reference<SizeHint>::type>
+accumulate_into(Accumulator& acc, Function&& f, SizeHint&& size_hint)
+  noexcept(std::is_nothrow_constructible<typename std::remove_reference<Function>::type, Function&&>::value
+           && std::is_nothrow_move_constructible<typename std::remove_reference<Function>::type>::value
+           && std::is_nothrow_constructible<typename std::remove_reference<SizeHint>::type, SizeHint&&>::value
+           && std::is_nothrow_move_constructible<typename std::remove_reference<SizeHint>::type>::value) {
+	return {acc, std::forward<Function>(f), std::forward<SizeHint>(size_hint)};
+}
+
+VTA_INSTRUMENTED_BEGIN
+
+template <typename Function>
+class all_of_f {
+	Function mF;
+
+public:
+	constexpr all_of_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args) const
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::all_of", sizeof...(Args));
+		bool result = true;
+		detail::swallow{0, detail::test_unless<false>(result, mF, std::forward<Args>(args))...};
+		return result;
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args)
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::all_of", sizeof...(Args));
+		bool result = true;
+		detail::swallow{0, detail::test_unless<false>(result, mF, std::forward<Args>(args))...};
+		return result;
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Function>
+constexpr all_of_f<typename std::remove_reference<Function>::type> all_of(Function&& f)
+  noexcept(std::is_nothrow_constructible<all_of_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+template <typename Function>
+class any_of_f {
+	Function mF;
+
+public:
+	constexpr any_of_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args) const
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::any_of", sizeof...(Args));
+		bool result = false;
+		detail::swallow{0, detail::test_unless<true>(result, mF, std::forward<Args>(args))...};
+		return result;
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args)
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::any_of", sizeof...(Args));
+		bool result = false;
+		detail::swallow{0, detail::test_unless<true>(result, mF, std::forward<Args>(args))...};
+		return result;
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Function>
+constexpr any_of_f<typename std::remove_reference<Function>::type> any_of(Function&& f)
+  noexcept(std::is_nothrow_constructible<any_of_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+template <typename Function>
+class none_of_f {
+	Function mF;
+
+public:
+	constexpr none_of_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args) const
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::none_of", sizeof...(Args));
+		bool result = false;
+		detail::swallow{0, detail::test_unless<true>(result, mF, std::forward<Args>(args))...};
+		return !result;
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr bool operator()(Args&&... args)
+	  noexcept(noexcept(detail::swallow{0, (static_cast<bool>(mF(std::forward<Args>(args))), 0)...})) {
+		VTA_PROBE("vta::none_of", sizeof...(Args));
+		bool result = false;
+		detail::swallow{0, detail::test_unless<true>(result, mF, std::forward<Args>(args))...};
+		return !result;
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr bool operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Function>
+constexpr none_of_f<typename std::remove_reference<Function>::type> none_of(Function&& f)
+  noexcept(std::is_nothrow_constructible<none_of_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+VTA_INSTRUMENTED_END
+
+namespace detail {
+
+// std::addressof without <memory>, which would more than double the cost of including this header
+template <typename T>
+T* address_of(T& t) noexcept {
+	return reinterpret_cast<T*>(&const_cast<char&>(reinterpret_cast<char const volatile&>(t)));
+}
+
+#ifndef NDEBUG
+// Whether no two of the arrays of n elements that start at columns overlap, which batch_loop relies on.
+// The columns are unrelated arrays, which only std::less puts in a total order.
+template <typename... Ts>
+bool disjoint(std::size_t n, Ts const*... columns) noexcept {
+	char const volatile* const begins[] = {reinterpret_cast<char const volatile*>(columns)...};
+	std::size_t const sizes[] = {n * sizeof(Ts)...};
+	std::less<void const volatile*> const before{};
+	for(std::size_t i = 0; i < sizeof...(Ts); ++i) {
+		for(std::size_t j = i + 1; j < sizeof...(Ts); ++j) {
+			if(before(begins[i], begins[j] + sizes[j]) && before(begins[j], begins[i] + sizes[i])) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+#endif
+
+template <typename Function, typename... Ts>
+void batch_loop(Function& f, std::size_t n, Ts* VTA_RESTRICT... columns) noexcept(noexcept(f(*columns...))) {
+	VTA_UNROLL
+	for(std::size_t i = 0; i < n; ++i) {
+		f(columns[i]...);
+	}
+}
+
+// Receives the first row after it has been through a transformation and runs the loop over the
+// columns that the transformed arguments belong to
+template <typename Function>
+class batch_kernel_f {
+	Function* mF;
+	std::size_t mSize;
+
+public:
+	constexpr batch_kernel_f(Function& f, std::size_t n) noexcept
+	: mF(&f)
+	, mSize(n) {
+	}
+
+	template <typename... Args>
+	void operator()(Args&&... first_row) const
+	  noexcept(noexcept(batch_loop(*mF, mSize, address_of(first_row)...))) {
+		batch_loop(*mF, mSize, address_of(first_row)...);
+	}
+};
+
+}
+
+template <typename Function, typename Transformation>
+class batch_f {
+	Function mF;
+
+public:
+	constexpr batch_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Ts>
+	void operator()(std::size_t n, Ts*... columns) const
+	  noexcept(noexcept(Transformation::transform(detail::batch_kernel_f<Function const>{mF, n}, *columns...))) {
+		if(n != 0) {
+			Transformation::transform(detail::batch_kernel_f<Function const>{mF, n}, *columns...);
+		}
+	}
+
+	template <typename... Ts>
+	void operator()(std::size_t n, Ts*... columns)
+	  noexcept(noexcept(Transformation::transform(detail::batch_kernel_f<Function>{mF, n}, *columns...))) {
+		if(n != 0) {
+			Transformation::transform(detail::batch_kernel_f<Function>{mF, n}, *columns...);
+		}
+	}
+
+	template <typename Range, typename... Ranges,
+	          typename = decltype(count(std::declval<Range&>().data(), std::declval<Ranges&>().data()...))>
+	void operator()(Range&& range, Ranges&&... ranges) const
+	  noexcept(noexcept((*this)(range.size(), range.data(), ranges.data()...))) {
+		assert(all_of([&range](auto const& r){ return r.size() == range.size(); })(ranges...));
+		assert(detail::disjoint(range.size(), range.data(), ranges.data()...));
+		(*this)(range.size(), range.data(), ranges.data()...);
+	}
+
+	template <typename Range, typename... Ranges,
+	          typename = decltype(count(std::declval<Range&>().data(), std::declval<Ranges&>().data()...))>
+	void operator()(Range&& range, Ranges&&... ranges)
+	  noexcept(noexcept((*this)(range.size(), range.data(), ranges.data()...))) {
+		assert(all_of([&range](auto const& r){ return r.size() == range.size(); })(ranges...));
+		assert(detail::disjoint(range.size(), range.data(), ranges.data()...));
+		(*this)(range.size(), range.data(), ranges.data()...);
+	}
+};
+
+/** A functor that calls f on each row of a set of parallel arrays. The arrays must not overlap, as the
+    loop over them is compiled on the assumption that writing through one column does not change
+    another, so the same array must not be passed twice. */
+template <typename Transformation = id, typename Function>
+constexpr batch_f<typename std::remove_reference<Function>::type, Transformation> batch(Function&& f)
+  noexcept(std::is_nothrow_constructible<batch_f<typename std::remove_reference<Function>::type, Transformation>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+}
+
+#endif
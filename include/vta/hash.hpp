@@ -0,0 +1,216 @@
+/******************************************************************//**
+ * \file   hash.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_5C93CA63_04CD_4B35_B454_4A0413503AA1
+#define INCLUDE_GUARD_5C93CA63_04CD_4B35_B454_4A0413503AA1
+
+// Hashes a parameter pack by packing its integers, enumerations and pointers into whole words
+
+#include "vta/core.hpp"
+#include "vta/functions.hpp"
+#include "vta/perfect_hash.hpp"
+#include "vta/transformations.hpp"
+#include "vta/unpack.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/** Whether a T can be hashed by its bytes. It is true for integers, enumerations and pointers, and can
+    be specialized as true for a trivially copyable type without padding whose equal values have equal
+    bytes. */
+template <typename T>
+struct is_contiguously_hashable
+  : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {
+};
+
+namespace detail {
+
+// Integers, enumerations and pointers are packed with their neighbours into words, other types that
+// are contiguously hashable are copied into words of their own, and the rest are reduced to one word
+// by std::hash
+enum class hash_kind {
+	packed,
+	copied,
+	fallback
+};
+
+template <typename T>
+struct hash_kind_of
+  : std::integral_constant<hash_kind, !is_contiguously_hashable<T>::value ? hash_kind::fallback
+                                    : std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value
+                                      ? hash_kind::packed
+                                      : hash_kind::copied> {
+};
+
+struct hash_position {
+	std::size_t word;
+	int shift;
+};
+
+template <typename... Ts>
+struct hash_layout {
+	static constexpr std::size_t count = sizeof...(Ts);
+
+	// Padded with a fallback so that there is no array of size 0 and the end is aligned to a word
+	static constexpr hash_kind kinds[] = {hash_kind_of<Ts>::value..., hash_kind::fallback};
+	static constexpr std::size_t sizes[] = {sizeof(Ts)..., 0};
+
+	// Where the argument at index starts. Packed arguments follow each other bit by bit, and may
+	// straddle two words, while any other argument starts a new word.
+	constexpr static hash_position place(std::size_t index) noexcept {
+		std::size_t bit = 0;
+		for(std::size_t i = 0;; ++i) {
+			if(kinds[i] != hash_kind::packed) {
+				bit = (bit + 63) / 64 * 64;
+			}
+			if(i == index) {
+				return {bit / 64, static_cast<int>(bit % 64)};
+			}
+			bit += kinds[i] == hash_kind::packed ? sizes[i] * 8
+			     : kinds[i] == hash_kind::copied ? (sizes[i] + 7) / 8 * 64
+			     : 64;
+		}
+	}
+
+	static constexpr std::size_t words = place(count).word;
+};
+
+template <typename... Ts>
+constexpr std::size_t hash_layout<Ts...>::count;
+
+template <typename... Ts>
+constexpr hash_kind hash_layout<Ts...>::kinds[];
+
+template <typename... Ts>
+constexpr std::size_t hash_layout<Ts...>::sizes[];
+
+template <typename... Ts>
+constexpr std::size_t hash_layout<Ts...>::words;
+
+constexpr std::uint64_t scalar_bits(bool value) noexcept {
+	return value ? 1 : 0;
+}
+
+// Converted through the unsigned type of the same size, so that a negative value does not spill into
+// the bits of its neighbours
+template <typename T>
+constexpr std::enable_if_t<std::is_integral<T>::value, std::uint64_t> scalar_bits(T value) noexcept {
+	return static_cast<std::make_unsigned_t<T>>(value);
+}
+
+template <typename T>
+constexpr std::enable_if_t<std::is_enum<T>::value, std::uint64_t> scalar_bits(T value) noexcept {
+	return scalar_bits(static_cast<std::underlying_type_t<T>>(value));
+}
+
+template <typename T>
+std::uint64_t scalar_bits(T* value) noexcept {
+	return reinterpret_cast<std::uintptr_t>(value);
+}
+
+template <std::size_t Word, int Shift, typename T>
+VTA_ALWAYS_INLINE constexpr void put_word(std::uint64_t* words, T const& value,
+                                          std::integral_constant<hash_kind, hash_kind::packed>) noexcept {
+	std::uint64_t const bits = scalar_bits(value);
+	words[Word] |= bits << Shift;
+	if(Shift + sizeof(T) * 8 > 64) {
+		words[Word + 1] |= bits >> (64 - Shift) % 64;
+	}
+}
+
+template <std::size_t Word, int Shift, typename T>
+VTA_ALWAYS_INLINE void put_word(std::uint64_t* words, T const& value,
+                                std::integral_constant<hash_kind, hash_kind::copied>) noexcept {
+	static_assert(std::is_trivially_copyable<T>::value, "A contiguously hashable type must be trivially copyable");
+	std::memcpy(words + Word, &value, sizeof(T));
+}
+
+template <std::size_t Word, int Shift, typename T>
+VTA_ALWAYS_INLINE void put_word(std::uint64_t* words, T const& value,
+                                std::integral_constant<hash_kind, hash_kind::fallback>) {
+	words[Word] = std::hash<T>{}(value);
+}
+
+// Multiplies between the words, so that their order matters, then avalanches the result with the
+// splitmix64 finaliser. A key that fits in one word costs just the finaliser.
+template <std::size_t Count>
+VTA_ALWAYS_INLINE constexpr std::uint64_t hash_words(std::uint64_t const* words, std::uint64_t seed) noexcept {
+	std::uint64_t hash = seed ^ words[0];
+	VTA_UNROLL
+	for(std::size_t i = 1; i < Count; ++i) {
+		hash = hash * 0x9e3779b97f4a7c15ull ^ words[i];
+	}
+	return mix(hash);
+}
+
+template <typename... Args, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr std::uint64_t hash_pack(std::index_sequence<Is...>, Args const&... args) {
+	typedef hash_layout<std::decay_t<Args const>...> layout;
+	std::uint64_t words[layout::words + 1] = {};
+	swallow{0, (put_word<layout::place(Is).word, layout::place(Is).shift, std::decay_t<Args const>>(
+	              words, args, hash_kind_of<std::decay_t<Args const>>{}), 0)...};
+	return hash_words<layout::words>(words, 0x27d4eb2f165667c5ull + sizeof...(Args));
+}
+
+}
+
+/** Hashes its arguments, which can be of any type that is contiguously hashable or has a std::hash.
+    Arrays, such as string literals, are hashed by their address. */
+struct hash_f {
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr std::uint64_t operator()(Args const&... args) const {
+		return detail::hash_pack(std::index_sequence_for<Args...>{}, args...);
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr std::uint64_t operator()(unpacked<Tuple>&& args) const {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename... Args>
+VTA_ALWAYS_INLINE constexpr std::uint64_t hash(Args const&... args) {
+	return hash_f{}(args...);
+}
+
+/** Hashes the arguments chosen and ordered by Transformation. */
+template <typename Transformation, typename... Args>
+VTA_ALWAYS_INLINE constexpr std::uint64_t hash_after(Args&&... args) {
+	return forward_after<Transformation>(hash_f{})(std::forward<Args>(args)...);
+}
+
+}
+
+#endif
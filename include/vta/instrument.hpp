@@ -0,0 +1,188 @@
+/******************************************************************//**
+ * \file   instrument.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_A69934C5_0C92_479C_AA5E_08A02A64E1F9
+#define INCLUDE_GUARD_A69934C5_0C92_479C_AA5E_08A02A64E1F9
+
+// Reports each call of an adaptor to a user-provided sink, so that profiles can attribute time to the
+// stages of a pipeline. The adaptors report themselves when VTA_INSTRUMENT is defined as 1, and
+// vta::instrument reports a single call site whether or not it is.
+
+#include "vta/core.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Define VTA_INSTRUMENT_CYCLES as 1 to time each probe with the cycle counter
+#ifndef VTA_INSTRUMENT_CYCLES
+#define VTA_INSTRUMENT_CYCLES 0
+#endif
+
+#if VTA_INSTRUMENT_CYCLES
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif !(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#include <chrono>
+#endif
+#endif
+
+namespace vta {
+
+/** One call of an instrumented adaptor. cycles includes the time spent in any stage nested inside the
+    call, and is 0 unless VTA_INSTRUMENT_CYCLES is 1. */
+struct probe {
+	char const* name;
+	int pack_size;
+	std::uint64_t cycles;
+};
+
+/** Receives every probe. It is called on the thread that made the call and must not throw. */
+typedef void (*probe_sink)(probe const&);
+
+namespace detail {
+
+inline std::atomic<probe_sink>& global_probe_sink() noexcept {
+	static std::atomic<probe_sink> sink{nullptr};
+	return sink;
+}
+
+#if VTA_INSTRUMENT_CYCLES
+inline std::uint64_t cycle_count() noexcept {
+#if defined(_MSC_VER)
+	return __rdtsc();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return __builtin_ia32_rdtsc();
+#else
+	return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+#endif
+
+// Strips the signature of type_name down to the name of T, as it is only spelled out by the
+// compiler-specific function name macros
+inline std::string type_name_from(char const* signature, char const* before, char const* after) {
+	std::string name = signature;
+	std::string::size_type const first = name.find(before);
+	std::string::size_type const last = name.rfind(after);
+	if(first == std::string::npos || last == std::string::npos || last < first + std::strlen(before)) {
+		return name;
+	}
+	return name.substr(first + std::strlen(before), last - first - std::strlen(before));
+}
+
+template <typename T>
+char const* type_name() {
+#if defined(_MSC_VER)
+	static std::string const name = type_name_from(__FUNCSIG__, "type_name<", ">(void)");
+#elif defined(__GNUC__)
+	static std::string const name = type_name_from(__PRETTY_FUNCTION__, "T = ", "]");
+#else
+	static std::string const name = __func__;
+#endif
+	return name.c_str();
+}
+
+// Sends a probe to the sink when it goes out of scope, which makes the probe of a stage cover the
+// stages nested inside it
+class probe_scope {
+	probe mProbe;
+	probe_sink mSink;
+
+public:
+	probe_scope(char const* name, int pack_size) noexcept
+	: mProbe{name, pack_size, 0}
+	, mSink(global_probe_sink().load(std::memory_order_relaxed)) {
+#if VTA_INSTRUMENT_CYCLES
+		if(mSink != nullptr) {
+			mProbe.cycles = cycle_count();
+		}
+#endif
+	}
+
+	probe_scope(probe_scope const&) = delete;
+	probe_scope& operator=(probe_scope const&) = delete;
+
+	~probe_scope() {
+		if(mSink != nullptr) {
+#if VTA_INSTRUMENT_CYCLES
+			mProbe.cycles = cycle_count() - mProbe.cycles;
+#endif
+			mSink(mProbe);
+		}
+	}
+};
+
+}
+
+/** Sends every probe to sink, or discards them if sink is null, and returns the previous sink. */
+inline probe_sink set_probe_sink(probe_sink sink) noexcept {
+	return detail::global_probe_sink().exchange(sink);
+}
+
+template <typename Function>
+class instrument_f {
+	char const* mName;
+	Function mF;
+
+public:
+	instrument_f(char const* name, Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mName(name)
+	, mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE auto operator()(Args&&... args) const
+	  noexcept(noexcept(mF(std::forward<Args>(args)...))) {
+		detail::probe_scope const scope{mName, sizeof...(Args)};
+		return mF(std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE auto operator()(Args&&... args)
+	  noexcept(noexcept(mF(std::forward<Args>(args)...))) {
+		detail::probe_scope const scope{mName, sizeof...(Args)};
+		return mF(std::forward<Args>(args)...);
+	}
+};
+
+template <typename Function>
+instrument_f<typename std::remove_reference<Function>::type> instrument(char const* name, Function&& f)
+  noexcept(std::is_nothrow_constructible<instrument_f<typename std::remove_reference<Function>::type>,
+                                         char const*,
+                                         Function&&>::value) {
+	return {name, std::forward<Function>(f)};
+}
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+/******************************************************************//**
+ * \file   memoize.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_C72AF801_57CC_4D92_BD7D_D5F3E71A8601
+#define INCLUDE_GUARD_C72AF801_57CC_4D92_BD7D_D5F3E71A8601
+
+// Wraps a function in a bounded cache of its results, keyed on its arguments, that can be shared by
+// many threads
+
+#include "vta/core.hpp"
+#include "vta/hash.hpp"
+#include "vta/type_map.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace vta {
+
+/** Counts of the calls to a memoized function. */
+struct memoize_statistics {
+	std::uint64_t hits;
+	std::uint64_t misses;
+	std::uint64_t evictions;
+
+	double hit_rate() const noexcept {
+		return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+	}
+};
+
+namespace detail {
+
+// The arguments of a call followed by its result, in one allocation that the cache and every caller
+// holding the result share
+template <typename Key, typename Result>
+struct memo_node {
+	Key key;
+	Result result;
+};
+
+struct memo_entry {
+	std::uint64_t hash = 0;
+	std::uint64_t node_type = 0;
+	std::shared_ptr<void const> node;
+	std::atomic<bool> referenced{false};
+};
+
+// One part of the cache with its own lock. Hits only take the lock for reading and mark their entry
+// as referenced, so that lookups on the same shard run in parallel. A full shard evicts with the
+// CLOCK algorithm: the hand sweeps the entries, clearing the referenced ones, and replaces the first
+// one that has not been used since the hand last passed it.
+class memo_shard {
+	mutable std::shared_timed_mutex mMutex;
+	std::unique_ptr<memo_entry[]> mEntries;
+	std::unordered_multimap<std::uint64_t, std::size_t> mIndex;
+	std::size_t mCapacity = 0;
+	std::size_t mSize = 0;
+	std::size_t mHand = 0;
+
+	template <typename Key, typename Result, typename Tied>
+	std::shared_ptr<Result const> find_locked(std::uint64_t hash, Tied const& key) const {
+		typedef memo_node<Key, Result> node_type;
+		auto range = mIndex.equal_range(hash);
+		for(; range.first != range.second; ++range.first) {
+			memo_entry& entry = mEntries[range.first->second];
+			if(entry.node_type != type_id<node_type>()) {
+				continue;
+			}
+			node_type const* node = static_cast<node_type const*>(entry.node.get());
+			if(node->key == key) {
+				entry.referenced.store(true, std::memory_order_relaxed);
+				return std::shared_ptr<Result const>(entry.node, &node->result);
+			}
+		}
+		return nullptr;
+	}
+
+	std::size_t evict() {
+		while(mEntries[mHand].referenced.exchange(false, std::memory_order_relaxed)) {
+			mHand = (mHand + 1) % mCapacity;
+		}
+		std::size_t const victim = mHand;
+		mHand = (mHand + 1) % mCapacity;
+
+		auto range = mIndex.equal_range(mEntries[victim].hash);
+		for(; range.first != range.second; ++range.first) {
+			if(range.first->second == victim) {
+				mIndex.erase(range.first);
+				break;
+			}
+		}
+		return victim;
+	}
+
+public:
+	void reserve(std::size_t capacity) {
+		mEntries.reset(new memo_entry[capacity]);
+		mIndex.reserve(capacity);
+		mCapacity = capacity;
+	}
+
+	template <typename Key, typename Result, typename Tied>
+	std::shared_ptr<Result const> find(std::uint64_t hash, Tied const& key) const {
+		std::shared_lock<std::shared_timed_mutex> lock(mMutex);
+		return find_locked<Key, Result>(hash, key);
+	}
+
+	// Returns the result already cached if another thread inserted the same key first
+	template <typename Key, typename Result>
+	std::shared_ptr<Result const> insert(std::uint64_t hash, std::shared_ptr<memo_node<Key, Result>> node,
+	                                     std::atomic<std::uint64_t>& evictions) {
+		std::unique_lock<std::shared_timed_mutex> lock(mMutex);
+		if(auto existing = find_locked<Key, Result>(hash, node->key)) {
+			return existing;
+		}
+
+		std::size_t i = mSize;
+		if(mSize < mCapacity) {
+			++mSize;
+		} else {
+			i = evict();
+			evictions.fetch_add(1, std::memory_order_relaxed);
+		}
+		Result const* result = &node->result;
+		memo_entry& entry = mEntries[i];
+		entry.hash = hash;
+		entry.node_type = type_id<memo_node<Key, Result>>();
+		entry.node = std::move(node);
+		entry.referenced.store(false, std::memory_order_relaxed);
+		mIndex.emplace(hash, i);
+		return std::shared_ptr<Result const>(entry.node, result);
+	}
+};
+
+// Splits the capacity between up to 16 shards, using fewer of them when the capacity is small so that
+// the cache holds exactly that many results
+class memo_cache {
+public:
+	static std::size_t const shard_count = 16;
+
+	explicit memo_cache(std::size_t capacity) {
+		capacity = capacity > 0 ? capacity : 1;
+		while(mShardBits < 4 && (std::size_t{2} << mShardBits) <= capacity) {
+			++mShardBits;
+		}
+		std::size_t const shards = std::size_t{1} << mShardBits;
+		for(std::size_t i = 0; i < shards; ++i) {
+			mShards[i].reserve(capacity / shards + (i < capacity % shards ? 1 : 0));
+		}
+	}
+
+	// The top bits of the hash pick the shard and the rest are left to the shard's index
+	memo_shard& shard(std::uint64_t hash) noexcept {
+		return mShards[static_cast<std::size_t>((hash >> 60) >> (4 - mShardBits))];
+	}
+
+	std::atomic<std::uint64_t> hits{0};
+	std::atomic<std::uint64_t> misses{0};
+	std::atomic<std::uint64_t> evictions{0};
+
+private:
+	memo_shard mShards[shard_count];
+	unsigned mShardBits = 0;
+};
+
+// Starts from the type of the cache entry, so that calls with arguments of different types do not
+// collide
+template <typename Node, typename... Args>
+std::uint64_t hash_arguments(Args const&... args) {
+	return vta::hash(type_id<Node>(), args...);
+}
+
+}
+
+/** Calls a function at most once for each set of arguments that are still in its cache. */
+template <typename Function>
+class memoize_f {
+	Function mF;
+	std::shared_ptr<detail::memo_cache> mCache;
+
+public:
+	memoize_f(Function f, std::size_t capacity)
+	: mF(std::move(f))
+	, mCache(std::make_shared<detail::memo_cache>(capacity)) {
+	}
+
+	/** Returns the result of f(args...), calling f only if it is not already cached. */
+	template <typename... Args>
+	std::shared_ptr<std::decay_t<decltype(std::declval<Function const&>()(std::declval<Args&>()...))> const>
+	operator()(Args&&... args) const {
+		typedef std::tuple<std::decay_t<Args>...> key_type;
+		typedef std::decay_t<decltype(mF(args...))> result_type;
+		typedef detail::memo_node<key_type, result_type> node_type;
+
+		std::uint64_t const hash = detail::hash_arguments<node_type>(args...);
+		detail::memo_shard& shard = mCache->shard(hash);
+		if(auto cached = shard.template find<key_type, result_type>(hash, std::tie(args...))) {
+			mCache->hits.fetch_add(1, std::memory_order_relaxed);
+			return cached;
+		}
+
+		// f runs without holding a lock, so two threads may both compute the same result, and the
+		// first to insert it wins
+		mCache->misses.fetch_add(1, std::memory_order_relaxed);
+		auto result = mF(args...);
+		auto node = std::make_shared<node_type>(node_type{key_type(std::forward<Args>(args)...), std::move(result)});
+		return shard.insert(hash, std::move(node), mCache->evictions);
+	}
+
+	memoize_statistics statistics() const noexcept {
+		return {mCache->hits.load(std::memory_order_relaxed),
+		        mCache->misses.load(std::memory_order_relaxed),
+		        mCache->evictions.load(std::memory_order_relaxed)};
+	}
+};
+
+template <typename Function>
+memoize_f<std::decay_t<Function>> memoize(Function&& f, std::size_t capacity = 1024) {
+	return {std::forward<Function>(f), capacity};
+}
+
+}
+
+#endif
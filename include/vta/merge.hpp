@@ -0,0 +1,281 @@
+/******************************************************************//**
+ * \file   merge.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_4397E0CC_A224_43AF_BC16_F85DAA01A054
+#define INCLUDE_GUARD_4397E0CC_A224_43AF_BC16_F85DAA01A054
+
+// Merges a fixed number of sorted ranges through a tournament tree whose shape is known at compile
+// time
+
+#include "vta/core.hpp"
+#include "vta/functions.hpp"
+#include "vta/transformations.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+struct less {
+	template <typename T, typename U>
+	constexpr bool operator()(T const& lhs, U const& rhs) const noexcept(noexcept(lhs < rhs)) {
+		return lhs < rhs;
+	}
+};
+
+// One of the sorted ranges, at the bottom of the tree. Elements of a range that was passed as an
+// rvalue are moved to the output instead of copied.
+template <typename Iterator, bool Move>
+class merge_leaf {
+	Iterator mIt;
+	Iterator mEnd;
+
+public:
+	typedef typename std::remove_reference<decltype(*std::declval<Iterator&>())>::type value_type;
+
+	merge_leaf(Iterator begin, Iterator end)
+	: mIt(std::move(begin))
+	, mEnd(std::move(end)) {
+	}
+
+	static int const size = 1;
+
+	// The next element of the range, or nullptr once it is exhausted
+	VTA_ALWAYS_INLINE value_type* head() const {
+		return mIt == mEnd ? nullptr : address_of(*mIt);
+	}
+
+	VTA_ALWAYS_INLINE int winner() const {
+		return 0;
+	}
+
+	VTA_ALWAYS_INLINE bool full() const {
+		return mIt != mEnd;
+	}
+
+	VTA_ALWAYS_INLINE value_type* front() const {
+		return address_of(*mIt);
+	}
+
+	template <typename Out>
+	VTA_ALWAYS_INLINE void pop(Out& out) {
+		*out = static_cast<typename std::conditional<Move, value_type&&, value_type&>::type>(*mIt);
+		++out;
+		++mIt;
+	}
+
+	template <typename Out>
+	VTA_ALWAYS_INLINE bool pop_full(Out& out) {
+		pop(out);
+		return mIt != mEnd;
+	}
+};
+
+// Holds the smaller of the heads of its two subtrees, so that taking an element from the merge only
+// compares the heads along the path to the leaf it came from
+template <typename Compare, typename Left, typename Right>
+class merge_node {
+public:
+	typedef typename std::remove_pointer<
+	  typename std::common_type<typename Left::value_type*, typename Right::value_type*>::type
+	>::type value_type;
+
+	merge_node(Compare& comp, Left left, Right right)
+	: mLeft(std::move(left))
+	, mRight(std::move(right))
+	, mComp(address_of(comp)) {
+		update();
+	}
+
+	static int const size = Left::size + Right::size;
+
+	VTA_ALWAYS_INLINE value_type* head() const {
+		return mHead;
+	}
+
+	// The index of the range that head() points into, counting from the leftmost leaf
+	VTA_ALWAYS_INLINE int winner() const {
+		return mWinner;
+	}
+
+	// Whether none of the ranges is exhausted
+	VTA_ALWAYS_INLINE bool full() const {
+		return mLeft.full() && mRight.full();
+	}
+
+	VTA_ALWAYS_INLINE value_type* front() const {
+		return mHead;
+	}
+
+	// Takes the head, following the winners down to its range, and updates the nodes on the path back
+	// up from it
+	template <typename Out>
+	VTA_ALWAYS_INLINE void pop(Out& out) {
+		if(mWinner < Left::size) {
+			mLeft.pop(out);
+		} else {
+			mRight.pop(out);
+		}
+		update();
+	}
+
+	// pop for while every range has elements left, which saves checking the heads for nullptr. Returns
+	// whether that is still so, and once it is not the tree is left as pop expects it.
+	template <typename Out>
+	VTA_ALWAYS_INLINE bool pop_full(Out& out) {
+		bool const full = mWinner < Left::size ? mLeft.pop_full(out) : mRight.pop_full(out);
+		if(full) {
+			update_full();
+		} else {
+			update();
+		}
+		return full;
+	}
+
+private:
+	// Ties go to the left, which holds the earlier ranges, so that the merge is stable
+	VTA_ALWAYS_INLINE void update() {
+		value_type* const left = mLeft.head();
+		value_type* const right = mRight.head();
+		bool const left_wins = right == nullptr || (left != nullptr && !(*mComp)(*right, *left));
+		mHead = left_wins ? left : right;
+		mWinner = left_wins ? mLeft.winner() : Left::size + mRight.winner();
+	}
+
+	VTA_ALWAYS_INLINE void update_full() {
+		value_type* const left = mLeft.front();
+		value_type* const right = mRight.front();
+		bool const left_wins = !(*mComp)(*right, *left);
+		mHead = left_wins ? left : right;
+		mWinner = left_wins ? mLeft.winner() : Left::size + mRight.winner();
+	}
+
+	Left mLeft;
+	Right mRight;
+	Compare* mComp;
+	value_type* mHead;
+	int mWinner;
+};
+
+template <typename Compare, typename Left, typename Right>
+VTA_ALWAYS_INLINE merge_node<Compare, Left, Right> make_merge_node(Compare& comp, Left left, Right right) {
+	return {comp, std::move(left), std::move(right)};
+}
+
+// Builds a balanced tree over the ranges, splitting them in half at each level
+template <typename Compare>
+struct make_merge_tree {
+	Compare* comp;
+
+	template <typename Range>
+	VTA_ALWAYS_INLINE merge_leaf<decltype(std::begin(std::declval<Range&>())), !std::is_lvalue_reference<Range>::value>
+	operator()(Range&& range) const {
+		return {std::begin(range), std::end(range)};
+	}
+
+	template <typename First, typename Second, typename... Ranges>
+	VTA_ALWAYS_INLINE auto operator()(First&& first, Second&& second, Ranges&&... ranges) const {
+		return make_merge_node(*comp,
+		                       take<(sizeof...(Ranges) + 2) / 2>::transform(*this, std::forward<First>(first),
+		                                                                 std::forward<Second>(second),
+		                                                                 std::forward<Ranges>(ranges)...),
+		                       drop<(sizeof...(Ranges) + 2) / 2>::transform(*this, std::forward<First>(first),
+		                                                                 std::forward<Second>(second),
+		                                                                 std::forward<Ranges>(ranges)...));
+	}
+};
+
+// Merges without checking for exhausted ranges until the first of them runs out, which for ranges of
+// similar lengths is most of the way
+template <typename Tree, typename Out>
+VTA_ALWAYS_INLINE void drain(Tree& tree, Out& out) {
+	if(tree.full()) {
+		while(tree.pop_full(out)) {
+		}
+	}
+	while(tree.head() != nullptr) {
+		tree.pop(out);
+	}
+}
+
+}
+
+namespace detail {
+
+template <typename Compare, typename Out, typename... Ranges>
+VTA_ALWAYS_INLINE void merge_ranges(Compare& comp, Out& out, Ranges&&... ranges) {
+	auto tree = make_merge_tree<Compare>{address_of(comp)}(std::forward<Ranges>(ranges)...);
+	drain(tree, out);
+}
+
+// Two ranges are merged with the loop of std::merge, as a tree of one node only adds bookkeeping
+template <typename Compare, typename Out, typename First, typename Second>
+VTA_ALWAYS_INLINE void merge_ranges(Compare& comp, Out& out, First&& first, Second&& second) {
+	make_merge_tree<Compare> const make_leaf{address_of(comp)};
+	auto left = make_leaf(std::forward<First>(first));
+	auto right = make_leaf(std::forward<Second>(second));
+	while(left.full() && right.full()) {
+		if(comp(*right.front(), *left.front())) {
+			right.pop(out);
+		} else {
+			left.pop(out);
+		}
+	}
+	for(; left.full(); left.pop(out)) {
+	}
+	for(; right.full(); right.pop(out)) {
+	}
+}
+
+}
+
+/** Merges the sorted ranges into out, ordered by comp, and returns the end of the output. */
+template <typename Compare, typename Out, typename... Ranges>
+Out merge_by(Compare comp, Out out, Ranges&&... ranges) {
+	detail::merge_ranges(comp, out, std::forward<Ranges>(ranges)...);
+	return out;
+}
+
+template <typename Compare, typename Out>
+Out merge_by(Compare, Out out) {
+	return out;
+}
+
+/** Merges the sorted ranges into out and returns the end of the output. */
+template <typename Out, typename... Ranges>
+Out merge(Out out, Ranges&&... ranges) {
+	return merge_by(detail::less{}, std::move(out), std::forward<Ranges>(ranges)...);
+}
+
+}
+
+#endif
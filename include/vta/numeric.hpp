@@ -0,0 +1,300 @@
+/******************************************************************//**
+ * \file   numeric.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_C67F4A91_4E74_4B7B_8A5A_39C256438020
+#define INCLUDE_GUARD_C67F4A91_4E74_4B7B_8A5A_39C256438020
+
+#include "vta/access.hpp"
+#include "vta/functions.hpp"
+#include "vta/predicates.hpp"
+
+#include <cfloat>
+#include <climits>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+namespace numeric {
+
+namespace detail {
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 int128;
+__extension__ typedef unsigned __int128 uint128;
+#endif
+
+template <typename T>
+struct bits {
+	static int const value = std::numeric_limits<T>::digits;
+};
+
+#ifdef __SIZEOF_INT128__
+template <>
+struct bits<int128> {
+	static int const value = 127;
+};
+
+template <>
+struct bits<uint128> {
+	static int const value = 128;
+};
+#endif
+
+// The number of bits needed to hold the sum of N values without overflow
+constexpr int headroom(int n) noexcept {
+	int bits = 0;
+	while((1ll << bits) < n) {
+		++bits;
+	}
+	return bits;
+}
+
+template <typename Wide, typename T, int N>
+struct fits : std::integral_constant<bool, bits<Wide>::value >= bits<T>::value + headroom(N)> {};
+
+template <typename T, int N, typename = void>
+struct wider {
+	typedef void type;
+};
+
+template <typename T, int N>
+struct wider<T, N, typename std::enable_if<std::is_signed<T>::value
+                                        && std::is_integral<T>::value
+                                        && fits<long long, T, N>::value>::type> {
+	typedef long long type;
+};
+
+template <typename T, int N>
+struct wider<T, N, typename std::enable_if<std::is_unsigned<T>::value
+                                        && fits<unsigned long long, T, N>::value>::type> {
+	typedef unsigned long long type;
+};
+
+#ifdef __SIZEOF_INT128__
+template <typename T, int N>
+struct wider<T, N, typename std::enable_if<std::is_signed<T>::value
+                                        && std::is_integral<T>::value
+                                        && !fits<long long, T, N>::value
+                                        && fits<int128, T, N>::value>::type> {
+	typedef int128 type;
+};
+
+template <typename T, int N>
+struct wider<T, N, typename std::enable_if<std::is_unsigned<T>::value
+                                        && !fits<unsigned long long, T, N>::value
+                                        && fits<uint128, T, N>::value>::type> {
+	typedef uint128 type;
+};
+#endif
+
+template <int N>
+struct wider<float, N> {
+	typedef double type;
+};
+
+// long double only helps if it has a larger exponent than double, e.g. x87 80-bit floats
+template <int N>
+struct wider<double, N, typename std::enable_if<(LDBL_MAX_EXP > DBL_MAX_EXP)>::type> {
+	typedef long double type;
+};
+
+// The wider type that mean divides its sum in. Dividing a 128-bit integer is a call into the runtime
+// library, so 64-bit integers take the exact path instead, which only divides them by the constant N
+template <typename T, int N, typename Wide = typename wider<T, N>::type>
+struct mean_wider {
+	typedef Wide type;
+};
+
+#ifdef __SIZEOF_INT128__
+template <typename T, int N>
+struct mean_wider<T, N, int128> {
+	typedef void type;
+};
+
+template <typename T, int N>
+struct mean_wider<T, N, uint128> {
+	typedef void type;
+};
+#endif
+
+template <typename T>
+struct plus {
+	constexpr T operator()(T lhs, T rhs) const noexcept {
+		return lhs + rhs;
+	}
+};
+
+template <typename T, typename... Args>
+constexpr T widened_sum(Args... args) noexcept {
+	return add_const(foldl(plus<T>{}))(T{0}, static_cast<T>(args)...);
+}
+
+template <typename T>
+struct running_mean {
+	T quotient;
+	T remainder;
+};
+
+// Sums each value divided by N, where N is a constant so that the division is compiled to a
+// multiplication, and keeps the remainders to correct the result with a single final division
+template <typename T, int N>
+struct exact_mean_step {
+	constexpr running_mean<T> operator()(running_mean<T> m, T t) const noexcept {
+		return {m.quotient + t / N, m.remainder + t % N};
+	}
+};
+
+template <typename T, int N>
+constexpr T exact_mean_result(running_mean<T> m) noexcept {
+	T const q = m.quotient + m.remainder / N;
+	T const r = m.remainder % N;
+	return (q > 0 && r < 0) ? q - 1
+	     : (q < 0 && r > 0) ? q + 1
+	     : q;
+}
+
+// A wider type exists so the sum cannot overflow
+template <typename T, int N, typename IsIntegral, typename... Args>
+constexpr T mean(std::true_type, IsIntegral, Args... args) noexcept {
+	typedef typename mean_wider<T, N>::type Wide;
+	return static_cast<T>(widened_sum<Wide>(args...) / N);
+}
+
+template <typename T, int N, typename... Args>
+constexpr T mean(std::false_type, std::true_type, Args... args) noexcept {
+	return exact_mean_result<T, N>(add_const(foldl(exact_mean_step<T, N>{}))(running_mean<T>{0, 0}, args...));
+}
+
+// Multiplying each value by the reciprocal of N cannot overflow
+template <typename T, int N, typename... Args>
+constexpr T mean(std::false_type, std::false_type, Args... args) noexcept {
+	return add_const(foldl(plus<T>{}))(T{0}, (args * (T{1} / N))...);
+}
+
+template <typename Arg, typename... Args>
+struct check_pack {
+	static_assert(vta::are_same_after<std::decay, Arg, Args...>::value,
+	  "All arguments must have the same type");
+	static_assert(std::is_arithmetic<typename std::decay<Arg>::type>::value,
+	  "Arguments must be arithmetic");
+	typedef typename std::decay<Arg>::type type;
+};
+
+}
+
+/** The type used to sum N values of type T without overflow, or void if there is no such type. */
+template <typename T, int N>
+using accumulator_t = typename detail::wider<T, N>::type;
+
+/** Returns the sum of args in a type wide enough that it cannot overflow. If there is no wider type
+    the sum is returned in the type of the arguments. */
+template <typename Arg, typename... Args>
+constexpr auto sum(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	typedef accumulator_t<T, sizeof...(Args) + 1> Wide;
+	typedef typename std::conditional<std::is_void<Wide>::value, T, Wide>::type Result;
+	return detail::widened_sum<Result>(arg, args...);
+}
+
+/** Returns the arithmetic mean of args without any intermediate overflow. Integer means are rounded
+    towards zero. */
+template <typename Arg, typename... Args>
+constexpr auto mean(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	int const N = sizeof...(Args) + 1;
+	typedef std::integral_constant<bool, !std::is_void<typename detail::mean_wider<T, N>::type>::value> Widen;
+	return detail::mean<T, N>(Widen{}, std::is_integral<T>{}, arg, args...);
+}
+
+/** Returns the smallest argument. */
+template <typename Arg, typename... Args>
+constexpr auto min(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	T const values[] = {arg, args...};
+	T result = arg;
+	for(T value : values) {
+		result = value < result ? value : result;
+	}
+	return result;
+}
+
+/** Returns the largest argument. */
+template <typename Arg, typename... Args>
+constexpr auto max(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	T const values[] = {arg, args...};
+	T result = arg;
+	for(T value : values) {
+		result = result < value ? value : result;
+	}
+	return result;
+}
+
+/** Returns the minimum and maximum of args in a single pass. */
+template <typename Arg, typename... Args>
+constexpr auto minmax(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	T const values[] = {arg, args...};
+	std::pair<T, T> result{arg, arg};
+	for(T value : values) {
+		result.first = value < result.first ? value : result.first;
+		result.second = result.second < value ? value : result.second;
+	}
+	return result;
+}
+
+/** Returns the position of the first minimum argument. */
+template <typename Arg, typename... Args>
+constexpr int argmin(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	T const values[] = {arg, args...};
+	int position = 0;
+	for(int i = 1; i < static_cast<int>(sizeof...(Args)) + 1; ++i) {
+		position = values[i] < values[position] ? i : position;
+	}
+	return position;
+}
+
+/** Returns the position of the first maximum argument. */
+template <typename Arg, typename... Args>
+constexpr int argmax(Arg arg, Args... args) noexcept {
+	typedef typename detail::check_pack<Arg, Args...>::type T;
+	T const values[] = {arg, args...};
+	int position = 0;
+	for(int i = 1; i < static_cast<int>(sizeof...(Args)) + 1; ++i) {
+		position = values[position] < values[i] ? i : position;
+	}
+	return position;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,185 @@
+/******************************************************************//**
+ * \file   packed_tuple.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_829B8E15_F895_4DF5_BD24_DC15CB568647
+#define INCLUDE_GUARD_829B8E15_F895_4DF5_BD24_DC15CB568647
+
+#include "vta/predicates.hpp"
+#include "vta/transformations.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+template <std::size_t I, typename T, bool Compress = std::is_empty<T>::value && !std::is_final<T>::value>
+class packed_leaf;
+
+template <std::size_t I, typename T>
+class packed_leaf<I, T, false> {
+	T mValue;
+
+public:
+	constexpr packed_leaf()
+	: mValue() {
+	}
+
+	template <typename U>
+	constexpr packed_leaf(U&& u)
+	: mValue(std::forward<U>(u)) {
+	}
+
+	constexpr T& get() & noexcept {
+		return mValue;
+	}
+
+	constexpr T const& get() const& noexcept {
+		return mValue;
+	}
+};
+
+// Empty types are stored as a base class so that they take up no space
+template <std::size_t I, typename T>
+class packed_leaf<I, T, true> : private T {
+public:
+	constexpr packed_leaf()
+	: T() {
+	}
+
+	template <typename U>
+	constexpr packed_leaf(U&& u)
+	: T(std::forward<U>(u)) {
+	}
+
+	constexpr T& get() & noexcept {
+		return *this;
+	}
+
+	constexpr T const& get() const& noexcept {
+		return *this;
+	}
+};
+
+struct from_refs_t {};
+
+template <typename Layout, typename... Ts>
+class packed_storage;
+
+// The leaves are inherited in the order given by Layout, but are always indexed by their position
+// in Ts...
+template <int... Ls, typename... Ts>
+class packed_storage<index_list<Ls...>, Ts...>
+  : public packed_leaf<Ls, typename std::tuple_element<Ls, std::tuple<Ts...>>::type>... {
+public:
+	constexpr packed_storage() = default;
+
+	template <typename Refs>
+	constexpr packed_storage(from_refs_t, Refs&& refs)
+	: packed_leaf<Ls, typename std::tuple_element<Ls, std::tuple<Ts...>>::type>(
+	    std::get<Ls>(std::forward<Refs>(refs)))... {
+	}
+};
+
+// Whether Us... would be better matched by the copy or move constructor of Tuple
+template <typename Tuple, typename... Us>
+struct is_packed_tuple_copy : std::integral_constant<bool, sizeof...(Us) == 0> {};
+
+template <typename Tuple, typename U>
+struct is_packed_tuple_copy<Tuple, U> : std::is_same<Tuple, typename std::decay<U>::type> {};
+
+template <typename... Ts>
+using packed_layout = typename sort_indices<greater_alignment, std::tuple<Ts...>, 0, sizeof...(Ts)>::type;
+
+}
+
+/** A tuple that stores its elements in descending order of alignment to minimise padding. Empty
+    types take up no space. Elements are still accessed in the order they were declared. */
+template <typename... Ts>
+class packed_tuple : private detail::packed_storage<detail::packed_layout<Ts...>, Ts...> {
+	typedef detail::packed_storage<detail::packed_layout<Ts...>, Ts...> Storage;
+
+	template <std::size_t I, typename... Us>
+	friend constexpr typename std::tuple_element<I, std::tuple<Us...>>::type&
+	get(packed_tuple<Us...>& t) noexcept;
+
+	template <std::size_t I, typename... Us>
+	friend constexpr typename std::tuple_element<I, std::tuple<Us...>>::type const&
+	get(packed_tuple<Us...> const& t) noexcept;
+
+public:
+	constexpr packed_tuple() = default;
+
+	template <typename... Us,
+	          typename std::enable_if<sizeof...(Us) == sizeof...(Ts)
+	                               && !detail::is_packed_tuple_copy<packed_tuple, Us...>::value>::type* = nullptr>
+	constexpr packed_tuple(Us&&... us)
+	: Storage(detail::from_refs_t{}, std::forward_as_tuple(std::forward<Us>(us)...)) {
+	}
+};
+
+template <std::size_t I, typename... Ts>
+constexpr typename std::tuple_element<I, std::tuple<Ts...>>::type& get(packed_tuple<Ts...>& t) noexcept {
+	typedef detail::packed_leaf<I, typename std::tuple_element<I, std::tuple<Ts...>>::type> Leaf;
+	return static_cast<Leaf&>(t).get();
+}
+
+template <std::size_t I, typename... Ts>
+constexpr typename std::tuple_element<I, std::tuple<Ts...>>::type const& get(packed_tuple<Ts...> const& t) noexcept {
+	typedef detail::packed_leaf<I, typename std::tuple_element<I, std::tuple<Ts...>>::type> Leaf;
+	return static_cast<Leaf const&>(t).get();
+}
+
+template <std::size_t I, typename... Ts>
+constexpr typename std::tuple_element<I, std::tuple<Ts...>>::type&& get(packed_tuple<Ts...>&& t) noexcept {
+	typedef typename std::tuple_element<I, std::tuple<Ts...>>::type Element;
+	return std::forward<Element>(get<I>(t));
+}
+
+template <typename... Ts>
+constexpr packed_tuple<typename std::decay<Ts>::type...> make_packed_tuple(Ts&&... ts) {
+	return {std::forward<Ts>(ts)...};
+}
+
+}
+
+namespace std {
+
+template <typename... Ts>
+struct tuple_size<vta::packed_tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, typename... Ts>
+struct tuple_element<I, vta::packed_tuple<Ts...>> : tuple_element<I, std::tuple<Ts...>> {};
+
+}
+
+#endif
@@ -0,0 +1,206 @@
+/******************************************************************//**
+ * \file   perfect_hash.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_5C65E96D_652D_4168_8311_47CDB4A93C28
+#define INCLUDE_GUARD_5C65E96D_652D_4168_8311_47CDB4A93C28
+
+// A perfect hash of a list of 64-bit ids that is built at compile time
+
+#include "vta/core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vta {
+
+namespace detail {
+
+// FNV-1a of a null-terminated string
+constexpr std::uint64_t hash_string(char const* s) noexcept {
+	std::uint64_t hash = 14695981039346656037ull;
+	for(; *s != '\0'; ++s) {
+		hash = (hash ^ static_cast<unsigned char>(*s)) * 1099511628211ull;
+	}
+	return hash;
+}
+
+// The finaliser of splitmix64, which spreads every bit of x across the result
+constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+	return x ^ (x >> 31);
+}
+
+constexpr std::uint64_t byte_at(char const* s, int i) noexcept {
+	return std::uint64_t{static_cast<unsigned char>(s[i])} << (8 * i);
+}
+
+// Reads four and eight bytes from s as a little-endian integer, which compilers turn into one load
+constexpr std::uint64_t read_4(char const* s) noexcept {
+	return byte_at(s, 0) | byte_at(s, 1) | byte_at(s, 2) | byte_at(s, 3);
+}
+
+constexpr std::uint64_t read_8(char const* s) noexcept {
+	return read_4(s) | read_4(s + 4) << 32;
+}
+
+// A hash of the first size characters of s that reads them a word at a time. Strings of up to 8
+// characters are hashed with at most two overlapping loads and no loop.
+VTA_ALWAYS_INLINE constexpr std::uint64_t hash_bytes(char const* s, std::size_t size) noexcept {
+	std::uint64_t hash = size * 0x9e3779b97f4a7c15ull;
+	if(size > 8) {
+		for(std::size_t i = 0; i + 8 < size; i += 8) {
+			hash = mix(hash ^ read_8(s + i));
+		}
+		hash ^= read_8(s + size - 8);
+	} else if(size >= 4) {
+		hash ^= read_4(s) << 32 | read_4(s + size - 4);
+	} else if(size > 0) {
+		hash ^= byte_at(s, 0) << 16 | byte_at(s + size / 2, 0) << 8 | byte_at(s + size - 1, 0);
+	}
+	return mix(hash);
+}
+
+constexpr int ceil_log2(std::size_t n) noexcept {
+	int bits = 0;
+	while((std::size_t{1} << bits) < n) {
+		++bits;
+	}
+	return bits;
+}
+
+// A hash, displace and compress table of ids whose bits are already well mixed. The top bits of an id
+// pick its bucket, of which there is one for about every two ids, and each bucket in turn is given
+// the first odd multiplier that sends its ids to slots that are still free. Looking an id up takes
+// one multiplication and a comparison against the id stored in its slot.
+template <std::size_t N>
+struct perfect_hash {
+	static int const slot_bits = ceil_log2(2 * N) < 1 ? 1 : ceil_log2(2 * N);
+	static int const bucket_bits = ceil_log2((N + 1) / 2) < 1 ? 1 : ceil_log2((N + 1) / 2);
+	static std::size_t const slots = std::size_t{1} << slot_bits;
+	static std::size_t const buckets = std::size_t{1} << bucket_bits;
+
+	// Set to false if the ids could not be placed, which only happens if two of them are equal
+	bool placed;
+	std::uint64_t ids[slots];
+	int indices[slots];
+	std::uint64_t multipliers[buckets];
+
+	constexpr static std::size_t bucket(std::uint64_t id) noexcept {
+		return static_cast<std::size_t>(id >> (64 - bucket_bits));
+	}
+
+	constexpr static std::size_t slot(std::uint64_t id, std::uint64_t multiplier) noexcept {
+		return static_cast<std::size_t>((id * multiplier) >> (64 - slot_bits));
+	}
+
+	// The position of id in the list the table was made from, or -1 if it is not there
+	VTA_ALWAYS_INLINE constexpr int find(std::uint64_t id) const noexcept {
+		std::size_t const s = slot(id, multipliers[bucket(id)]);
+		return ids[s] == id ? indices[s] : -1;
+	}
+};
+
+template <std::size_t N>
+constexpr std::size_t perfect_hash<N>::slots;
+
+template <std::size_t N>
+constexpr std::size_t perfect_hash<N>::buckets;
+
+template <std::size_t N>
+constexpr perfect_hash<N> make_perfect_hash(std::uint64_t const (&ids)[N + 1]) noexcept {
+	typedef perfect_hash<N> table;
+	table result{};
+	result.placed = true;
+	for(std::size_t s = 0; s < table::slots; ++s) {
+		result.indices[s] = -1;
+	}
+
+	// Sort the ids by bucket, so that each bucket is a contiguous run of members
+	std::size_t starts[table::buckets + 1] = {};
+	for(std::size_t i = 0; i < N; ++i) {
+		++starts[table::bucket(ids[i]) + 1];
+	}
+	std::size_t largest = 0;
+	for(std::size_t b = 0; b < table::buckets; ++b) {
+		largest = starts[b + 1] > largest ? starts[b + 1] : largest;
+		starts[b + 1] += starts[b];
+	}
+	std::size_t members[N + 1] = {};
+	std::size_t filled[table::buckets + 1] = {};
+	for(std::size_t i = 0; i < N; ++i) {
+		std::size_t const b = table::bucket(ids[i]);
+		members[starts[b] + filled[b]++] = i;
+	}
+
+	// Place the largest buckets first, while most slots are free
+	for(std::size_t size = largest; size > 0; --size) {
+		for(std::size_t b = 0; b < table::buckets; ++b) {
+			if(starts[b + 1] - starts[b] != size) {
+				continue;
+			}
+			unsigned seed = 0;
+			std::uint64_t multiplier = 0;
+			for(; seed < 65536u; ++seed) {
+				multiplier = mix(seed + 1ull) | 1;
+				std::size_t taken = 0;
+				for(; taken < size; ++taken) {
+					std::size_t const i = members[starts[b] + taken];
+					std::size_t const s = table::slot(ids[i], multiplier);
+					if(result.indices[s] != -1) {
+						break;
+					}
+					result.ids[s] = ids[i];
+					result.indices[s] = static_cast<int>(i);
+				}
+				if(taken == size) {
+					break;
+				}
+				while(taken > 0) {
+					std::size_t const i = members[starts[b] + --taken];
+					std::size_t const s = table::slot(ids[i], multiplier);
+					result.ids[s] = 0;
+					result.indices[s] = -1;
+				}
+			}
+			if(seed == 65536u) {
+				result.placed = false;
+				return result;
+			}
+			result.multipliers[b] = multiplier;
+		}
+	}
+	return result;
+}
+
+}
+
+}
+
+#endif
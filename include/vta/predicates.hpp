@@ -0,0 +1,161 @@
+/******************************************************************//**
+ * \file   predicates.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_46707BBF_FCC6_4089_AD5A_03E028F84E09
+#define INCLUDE_GUARD_46707BBF_FCC6_4089_AD5A_03E028F84E09
+
+// Predicates on the types of parameter packs
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/**************************************************************************************************
+ * Predicates                                                                                     *
+ **************************************************************************************************/
+
+/** are_same */
+template <typename... Args>
+struct are_same;
+
+template <typename First, typename Second, typename... Args>
+struct are_same<First, Second, Args...> {
+	static bool const value = std::is_same<First, Second>::value
+	                       && are_same<Second, Args...>::value;
+};
+
+template <typename Arg>
+struct are_same<Arg> : public std::true_type {};
+
+template <>
+struct are_same<> : public std::true_type {};
+
+/** are_same_after */
+template <template<class> class TypeTransformation, typename... Args>
+struct are_same_after {
+	static bool const value = vta::are_same<typename TypeTransformation<Args>::type...>::value;
+};
+
+/** are_unique_ints */
+template <int... Ns>
+struct are_unique_ints;
+
+template <>
+struct are_unique_ints<> {
+	static bool const value = true;
+};
+
+template <int N>
+struct are_unique_ints<N> {
+	static bool const value = true;
+};
+
+template <int M, int N, int... Ns>
+struct are_unique_ints<M, N, Ns...> {
+	static bool const value = (M != N)
+	                        && are_unique_ints<M, Ns...>::value
+	                        && are_unique_ints<N, Ns...>::value;
+};
+
+namespace detail {
+
+// A class that derives from indexed<I, T> for each type T at position I of a pack. Deducing I from a
+// conversion to indexed<I, T> finds the position of T with a single lookup of the bases, and fails if
+// T appears more than once. References are split into the referred type and the kind of reference,
+// as GCC finds indexed<I, int&> ambiguous with a base of indexed<J, int&&>.
+template <typename T>
+struct reference_kind : std::integral_constant<int, std::is_lvalue_reference<T>::value ? 1
+                                                    : std::is_rvalue_reference<T>::value ? 2
+                                                    : 0> {};
+
+template <std::size_t I, typename T, int ReferenceKind>
+struct indexed {};
+
+template <typename Indices, typename... Ts>
+struct index_table;
+
+template <std::size_t... Is, typename... Ts>
+struct index_table<std::index_sequence<Is...>, Ts...>
+  : indexed<Is, typename std::remove_reference<Ts>::type, reference_kind<Ts>::value>... {};
+
+template <typename... Ts>
+using index_table_for = index_table<std::index_sequence_for<Ts...>, Ts...>;
+
+template <typename T, std::size_t I>
+std::integral_constant<std::size_t, I> index_in(
+  indexed<I, typename std::remove_reference<T>::type, reference_kind<T>::value> const&);
+
+template <typename T, typename Table, typename = void>
+struct has_unique_index : std::false_type {};
+
+template <typename T, typename Table>
+struct has_unique_index<T, Table, decltype(static_cast<void>(index_in<T>(std::declval<Table>())))>
+  : std::true_type {};
+
+template <bool...>
+struct bool_list {};
+
+template <typename>
+struct always_true : std::true_type {};
+
+}
+
+/** are_unique */
+template <typename... Args>
+struct are_unique {
+	static bool const value
+	  = std::is_same<detail::bool_list<detail::has_unique_index<Args, detail::index_table_for<Args...>>::value...>,
+	                 detail::bool_list<detail::always_true<Args>::value...>>::value;
+};
+
+/** are_unique_after */
+template <template<class> class TypeTransformation, typename... Args>
+struct are_unique_after {
+	static bool const value = vta::are_unique<typename TypeTransformation<Args>::type...>::value;
+};
+
+/** greater_alignment */
+template <typename T, typename U>
+struct greater_alignment {
+	static bool const value = alignof(typename std::remove_reference<T>::type)
+	                        > alignof(typename std::remove_reference<U>::type);
+};
+
+/** greater_size */
+template <typename T, typename U>
+struct greater_size {
+	static bool const value = sizeof(typename std::remove_reference<T>::type)
+	                        > sizeof(typename std::remove_reference<U>::type);
+};
+
+}
+
+#endif
@@ -0,0 +1,271 @@
+/******************************************************************//**
+ * \file   rpn.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_13E5B094_A816_4FFF_BE60_033D71CA58E9
+#define INCLUDE_GUARD_13E5B094_A816_4FFF_BE60_033D71CA58E9
+
+#include "vta/access.hpp"
+#include "vta/functions.hpp"
+#include "vta/transformations.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+namespace rpn {
+
+/**************************************************************************************************
+ * Tokens                                                                                         *
+ **************************************************************************************************/
+
+/** A placeholder for the N-th argument passed when evaluating an expression. */
+template <int N>
+struct arg_t {
+	template <typename... Args>
+	constexpr auto operator()(Args const&... args) const {
+		return vta::at<N>(args...);
+	}
+};
+
+template <int N>
+constexpr arg_t<N> arg{};
+
+/** Operators are any type with a static arity of 1 or 2 and a static apply function. */
+struct add_t {
+	static int const arity = 2;
+
+	template <typename L, typename R>
+	constexpr static auto apply(L l, R r) {
+		return l + r;
+	}
+};
+
+struct subtract_t {
+	static int const arity = 2;
+
+	template <typename L, typename R>
+	constexpr static auto apply(L l, R r) {
+		return l - r;
+	}
+};
+
+struct multiply_t {
+	static int const arity = 2;
+
+	template <typename L, typename R>
+	constexpr static auto apply(L l, R r) {
+		return l * r;
+	}
+};
+
+struct divide_t {
+	static int const arity = 2;
+
+	template <typename L, typename R>
+	constexpr static auto apply(L l, R r) {
+		return l / r;
+	}
+};
+
+struct negate_t {
+	static int const arity = 1;
+
+	template <typename T>
+	constexpr static auto apply(T t) {
+		return -t;
+	}
+};
+
+constexpr add_t add{};
+constexpr subtract_t subtract{};
+constexpr multiply_t multiply{};
+constexpr divide_t divide{};
+constexpr negate_t negate{};
+
+/**************************************************************************************************
+ * Expressions                                                                                    *
+ **************************************************************************************************/
+
+/** A number that appeared in the tokens. */
+template <typename T>
+class constant {
+	T mValue;
+
+public:
+	constexpr constant(T value)
+	: mValue(value) {
+	}
+
+	template <typename... Args>
+	constexpr T operator()(Args const&...) const {
+		return mValue;
+	}
+};
+
+/** The result of applying the operator Op to the results of Operands... */
+template <typename Op, typename... Operands>
+class expression;
+
+template <typename Op, typename Operand>
+class expression<Op, Operand> {
+	Operand mOperand;
+
+public:
+	constexpr expression(Operand operand)
+	: mOperand(operand) {
+	}
+
+	template <typename... Args>
+	constexpr auto operator()(Args const&... args) const {
+		return Op::apply(mOperand(args...));
+	}
+};
+
+template <typename Op, typename LHS, typename RHS>
+class expression<Op, LHS, RHS> {
+	LHS mLHS;
+	RHS mRHS;
+
+public:
+	constexpr expression(LHS lhs, RHS rhs)
+	: mLHS(lhs)
+	, mRHS(rhs) {
+	}
+
+	template <typename... Args>
+	constexpr auto operator()(Args const&... args) const {
+		return Op::apply(mLHS(args...), mRHS(args...));
+	}
+};
+
+namespace detail {
+
+struct empty_stack {
+	static int const depth = 0;
+};
+
+template <typename Top, typename Rest>
+struct stack {
+	static int const depth = Rest::depth + 1;
+
+	Top top;
+	Rest rest;
+};
+
+template <typename Top, typename Rest>
+constexpr stack<Top, Rest> push(Top top, Rest rest) {
+	return {top, rest};
+}
+
+template <typename T, typename = void>
+struct is_operator : std::false_type {};
+
+template <typename T>
+struct is_operator<T, typename std::enable_if<(T::arity > 0)>::type> : std::true_type {};
+
+template <typename Op, typename Stack>
+constexpr Stack reduce(Stack s, std::false_type) {
+	return s;
+}
+
+template <typename Op, typename Stack>
+constexpr auto reduce(Stack s, std::integral_constant<int, 1>) {
+	typedef decltype(s.top) Operand;
+	return push(expression<Op, Operand>{s.top}, s.rest);
+}
+
+template <typename Op, typename Stack>
+constexpr auto reduce(Stack s, std::integral_constant<int, 2>) {
+	typedef decltype(s.rest.top) LHS;
+	typedef decltype(s.top) RHS;
+	return push(expression<Op, LHS, RHS>{s.rest.top, s.top}, s.rest.rest);
+}
+
+// Pushes each token on to a stack of expressions, an operator replaces its operands on the top of
+// the stack with a single expression
+struct compiler {
+	template <typename Stack, int N>
+	constexpr auto operator()(Stack s, arg_t<N>) const {
+		return push(arg_t<N>{}, s);
+	}
+
+	template <typename Stack, typename Op, typename std::enable_if<is_operator<Op>::value>::type* = nullptr>
+	constexpr auto operator()(Stack s, Op) const {
+		static_assert(Op::arity == 1 || Op::arity == 2, "Operators must take 1 or 2 operands");
+		static_assert(Stack::depth >= Op::arity,
+		  "Stack underflow, an operator does not have enough operands before it");
+		typedef typename std::conditional<(Stack::depth >= Op::arity),
+		                                  std::integral_constant<int, Op::arity>,
+		                                  std::false_type>::type Reduction;
+		return reduce<Op>(s, Reduction{});
+	}
+
+	template <typename Stack, typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+	constexpr auto operator()(Stack s, T value) const {
+		return push(constant<T>{value}, s);
+	}
+};
+
+// Pushes the tokens on to an empty stack. Without any tokens there is nothing to fold, and the empty
+// stack is left for compile to report
+template <typename Token, typename... Tokens>
+constexpr auto compile_stack(Token token, Tokens... tokens) {
+	return add_const(foldl(compiler{}))(empty_stack{}, token, tokens...);
+}
+
+constexpr empty_stack compile_stack() {
+	return {};
+}
+
+template <typename Stack>
+constexpr auto top(Stack s) {
+	return s.top;
+}
+
+constexpr empty_stack top(empty_stack s) {
+	return s;
+}
+
+}
+
+/** Compiles the reverse Polish notation tokens into an expression. Evaluating the expression with
+    some arguments replaces each arg<N> with the N-th argument. */
+template <typename... Tokens>
+constexpr auto compile(Tokens... tokens) {
+	auto const s = detail::compile_stack(tokens...);
+	static_assert(decltype(s)::depth != 0, "There must be at least one value to compile");
+	static_assert(decltype(s)::depth <= 1,
+	  "Stack overflow, there are values that are not used by any operator");
+	return detail::top(s);
+}
+
+}
+}
+
+#endif
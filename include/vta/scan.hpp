@@ -0,0 +1,168 @@
+/******************************************************************//**
+ * \file   scan.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_91A3A188_FAC4_4747_A346_FD2B466C7CCD
+#define INCLUDE_GUARD_91A3A188_FAC4_4747_A346_FD2B466C7CCD
+
+// Functors that return every partial result of a fold
+
+#include "vta/core.hpp"
+#include "vta/predicates.hpp"
+#include "vta/transformations.hpp"
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+// Results that all have the same type are returned in a std::array, otherwise in a std::tuple
+template <bool Same, typename... Results>
+struct scan_result {
+	typedef std::tuple<Results...> type;
+};
+
+template <typename First, typename... Results>
+struct scan_result<true, First, Results...> {
+	typedef std::array<First, 1 + sizeof...(Results)> type;
+};
+
+struct make_scan_result {
+	template <typename... Results>
+	VTA_ALWAYS_INLINE constexpr typename scan_result<are_same<Results...>::value, Results...>::type
+	operator()(Results&&... results) const
+	  noexcept(std::is_nothrow_constructible<typename scan_result<are_same<Results...>::value, Results...>::type,
+	                                         Results&&...>::value) {
+		return typename scan_result<are_same<Results...>::value, Results...>::type{std::move(results)...};
+	}
+};
+
+// Holds the results Done... computed so far and the accumulator, and folds in the next argument.
+// Order is id for scanl and reverse for scanr, where the arguments arrive reversed and the
+// function takes the accumulator as its second argument.
+template <typename Order, typename... Done>
+struct scan {
+	template <typename Function, typename Acc>
+	VTA_ALWAYS_INLINE constexpr static auto step(Function&, Done... done, Acc acc)
+	  noexcept(noexcept(Order::transform(make_scan_result{}, std::move(done)..., std::move(acc)))) {
+		return Order::transform(make_scan_result{}, std::move(done)..., std::move(acc));
+	}
+
+	template <typename Function, typename Acc, typename First, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto step(Function& f, Done... done, Acc acc, First&& first, Args&&... args)
+	  noexcept(noexcept(Order::transform(f, acc, std::forward<First>(first)))
+	           && noexcept(scan<Order, Done..., Acc>::step(f, std::move(done)..., std::move(acc),
+	                                                       std::declval<typename std::decay<decltype(Order::transform(f, acc, std::forward<First>(first)))>::type>(),
+	                                                       std::forward<Args>(args)...))) {
+		typename std::decay<decltype(Order::transform(f, acc, std::forward<First>(first)))>::type next
+		  = Order::transform(f, acc, std::forward<First>(first));
+		return scan<Order, Done..., Acc>::step(f, std::move(done)..., std::move(acc), std::move(next),
+		                                       std::forward<Args>(args)...);
+	}
+};
+
+template <typename Order, typename Function>
+struct scan_from {
+	Function& f;
+
+	template <typename Init, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Init&& init, Args&&... args) const
+	  noexcept(noexcept(scan<Order>::step(f, typename std::decay<Init>::type(std::forward<Init>(init)),
+	                                      std::forward<Args>(args)...))) {
+		return scan<Order>::step(f, typename std::decay<Init>::type(std::forward<Init>(init)),
+		                         std::forward<Args>(args)...);
+	}
+};
+
+}
+
+template <typename Function>
+class scanl_f {
+	Function mF;
+
+public:
+	constexpr scanl_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename Init, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Init&& init, Args&&... args) const
+	  noexcept(noexcept(detail::scan_from<id, Function const>{mF}(std::forward<Init>(init), std::forward<Args>(args)...))) {
+		return detail::scan_from<id, Function const>{mF}(std::forward<Init>(init), std::forward<Args>(args)...);
+	}
+
+	template <typename Init, typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Init&& init, Args&&... args)
+	  noexcept(noexcept(detail::scan_from<id, Function>{mF}(std::forward<Init>(init), std::forward<Args>(args)...))) {
+		return detail::scan_from<id, Function>{mF}(std::forward<Init>(init), std::forward<Args>(args)...);
+	}
+};
+
+template <typename Function>
+constexpr scanl_f<typename std::remove_reference<Function>::type> scanl(Function&& f)
+  noexcept(std::is_nothrow_constructible<scanl_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+template <typename Function>
+class scanr_f {
+	Function mF;
+
+public:
+	constexpr scanr_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const
+	  noexcept(noexcept(reverse::transform(detail::scan_from<reverse, Function const>{mF}, std::forward<Args>(args)...))) {
+		return reverse::transform(detail::scan_from<reverse, Function const>{mF}, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args)
+	  noexcept(noexcept(reverse::transform(detail::scan_from<reverse, Function>{mF}, std::forward<Args>(args)...))) {
+		return reverse::transform(detail::scan_from<reverse, Function>{mF}, std::forward<Args>(args)...);
+	}
+};
+
+template <typename Function>
+constexpr scanr_f<typename std::remove_reference<Function>::type> scanr(Function&& f)
+  noexcept(std::is_nothrow_constructible<scanr_f<typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+}
+
+#endif
@@ -0,0 +1,324 @@
+/******************************************************************//**
+ * \file   soa_vector.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_A7801F19_E5AB_4F7A_8759_D7A50F622DF1
+#define INCLUDE_GUARD_A7801F19_E5AB_4F7A_8759_D7A50F622DF1
+
+#include "vta/access.hpp"
+#include "vta/functions.hpp"
+#include "vta/predicates.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/** A sequence container that stores each of Ts... in its own contiguous column. All columns share a
+    single allocation and each column begins on a column_alignment boundary. */
+template <typename... Ts>
+class soa_vector {
+	static_assert(sizeof...(Ts) > 0, "soa_vector must have at least one column");
+
+	template <std::size_t I>
+	using column_t = typename std::tuple_element<I, std::tuple<Ts...>>::type;
+
+public:
+	static std::size_t const column_alignment = 64;
+	static_assert(std::is_same<detail::bool_list<(alignof(Ts) <= column_alignment)...>,
+	                           detail::bool_list<detail::always_true<Ts>::value...>>::value,
+	              "Columns cannot be aligned to more than column_alignment");
+
+	soa_vector() noexcept
+	: mBlock(nullptr)
+	, mColumns()
+	, mSize(0)
+	, mCapacity(0) {
+	}
+
+	soa_vector(soa_vector const& other)
+	: soa_vector() {
+		reserve(other.mSize);
+		for(std::size_t i = 0; i < other.mSize; ++i) {
+			vta::apply([this](Ts const&... row){ push_back(row...); }, other.row(i));
+		}
+	}
+
+	soa_vector(soa_vector&& other) noexcept
+	: soa_vector() {
+		swap(other);
+	}
+
+	soa_vector& operator=(soa_vector other) noexcept {
+		swap(other);
+		return *this;
+	}
+
+	~soa_vector() {
+		clear();
+		::operator delete(mBlock);
+	}
+
+	void swap(soa_vector& other) noexcept {
+		std::swap(mBlock, other.mBlock);
+		std::swap(mColumns, other.mColumns);
+		std::swap(mSize, other.mSize);
+		std::swap(mCapacity, other.mCapacity);
+	}
+
+	std::size_t size() const noexcept {
+		return mSize;
+	}
+
+	std::size_t capacity() const noexcept {
+		return mCapacity;
+	}
+
+	bool empty() const noexcept {
+		return mSize == 0;
+	}
+
+	static std::size_t max_size() noexcept {
+		std::size_t const sizes[] = {sizeof(Ts)...};
+		std::size_t row_size = 0;
+		for(std::size_t size : sizes) {
+			row_size += size;
+		}
+		std::size_t const padding = (sizeof...(Ts) + 1) * column_alignment;
+		return (static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) - padding) / row_size;
+	}
+
+	/** Returns a pointer to the first element of the I-th column. */
+	template <std::size_t I>
+	column_t<I>* column() noexcept {
+		return std::get<I>(mColumns);
+	}
+
+	template <std::size_t I>
+	column_t<I> const* column() const noexcept {
+		return std::get<I>(mColumns);
+	}
+
+	/** Returns references to the elements of the i-th row. */
+	std::tuple<Ts&...> row(std::size_t i) noexcept {
+		return row(i, std::index_sequence_for<Ts...>{});
+	}
+
+	std::tuple<Ts const&...> row(std::size_t i) const noexcept {
+		return row(i, std::index_sequence_for<Ts...>{});
+	}
+
+	/** Appends a row, constructing the I-th column from the I-th argument. The arguments must not
+	    refer to elements of this soa_vector. */
+	template <typename... Args>
+	void push_back(Args&&... args) {
+		static_assert(sizeof...(Args) == sizeof...(Ts), "There must be one argument for each column");
+		if(mSize == mCapacity) {
+			reserve(mCapacity == 0 ? 8 : 2 * mCapacity);
+		}
+
+		construct<0>(mSize, std::forward<Args>(args)...);
+		++mSize;
+	}
+
+	void pop_back() noexcept {
+		--mSize;
+		destroy_row(mSize, std::index_sequence_for<Ts...>{});
+	}
+
+	void clear() noexcept {
+		while(mSize != 0) {
+			pop_back();
+		}
+	}
+
+	void reserve(std::size_t capacity) {
+		if(capacity <= mCapacity) {
+			return;
+		}
+
+		soa_vector grown;
+		grown.mBlock = ::operator new(block_size(capacity));
+		grown.mCapacity = capacity;
+		grown.mColumns = layout(grown.mBlock, capacity, std::index_sequence_for<Ts...>{});
+		relocate<true, 0>(grown);
+		try {
+			relocate<false, 0>(grown);
+		} catch(...) {
+			grown.destroy_copied_columns(mSize, std::index_sequence_for<Ts...>{});
+			throw;
+		}
+		grown.mSize = mSize;
+		swap(grown);
+	}
+
+private:
+	void* mBlock;
+	std::tuple<Ts*...> mColumns;
+	std::size_t mSize;
+	std::size_t mCapacity;
+
+	static std::size_t align_up(std::size_t n) noexcept {
+		return (n + column_alignment - 1) / column_alignment * column_alignment;
+	}
+
+	static std::size_t block_size(std::size_t capacity) {
+		if(capacity > max_size()) {
+			throw std::length_error{"soa_vector capacity is too large"};
+		}
+
+		std::size_t const sizes[] = {align_up(capacity * sizeof(Ts))...};
+		std::size_t total = column_alignment - 1;
+		for(std::size_t size : sizes) {
+			total += size;
+		}
+		return total;
+	}
+
+	template <std::size_t... Is>
+	static std::tuple<Ts*...> layout(void* block, std::size_t capacity, std::index_sequence<Is...>) noexcept {
+		std::size_t const sizes[] = {align_up(capacity * sizeof(Ts))...};
+		std::size_t offsets[sizeof...(Ts)] = {};
+		for(std::size_t i = 1; i < sizeof...(Ts); ++i) {
+			offsets[i] = offsets[i - 1] + sizes[i - 1];
+		}
+
+		auto const start = align_up(reinterpret_cast<std::uintptr_t>(block));
+		return std::tuple<Ts*...>{reinterpret_cast<Ts*>(start + offsets[Is])...};
+	}
+
+	template <std::size_t... Is>
+	std::tuple<Ts&...> row(std::size_t i, std::index_sequence<Is...>) noexcept {
+		return std::tuple<Ts&...>{std::get<Is>(mColumns)[i]...};
+	}
+
+	template <std::size_t... Is>
+	std::tuple<Ts const&...> row(std::size_t i, std::index_sequence<Is...>) const noexcept {
+		return std::tuple<Ts const&...>{std::get<Is>(mColumns)[i]...};
+	}
+
+	template <std::size_t... Is>
+	void destroy_row(std::size_t i, std::index_sequence<Is...>) noexcept {
+		vta::map([](auto* element){
+			typedef typename std::remove_pointer<decltype(element)>::type T;
+			element->~T();
+		})((std::get<Is>(mColumns) + i)...);
+	}
+
+	// Constructs the elements of a row one column at a time, destroying the columns already
+	// constructed if one throws
+	template <std::size_t I, typename Arg, typename... Args>
+	void construct(std::size_t i, Arg&& arg, Args&&... args) {
+		typedef column_t<I> T;
+		::new (static_cast<void*>(column<I>() + i)) T(std::forward<Arg>(arg));
+		try {
+			construct<I + 1>(i, std::forward<Args>(args)...);
+		} catch(...) {
+			column<I>()[i].~T();
+			throw;
+		}
+	}
+
+	template <std::size_t I>
+	void construct(std::size_t) noexcept {
+	}
+
+	// Whether a column is copied rather than moved into a new block, because moving it may throw
+	template <std::size_t I>
+	using relocated_by_copy = std::integral_constant<bool, !std::is_nothrow_move_constructible<column_t<I>>::value
+	                                                       && std::is_copy_constructible<column_t<I>>::value>;
+
+	// Copies every column that relocated_by_copy is true for into the new block of grown if Copy is
+	// true, or moves every other column otherwise, destroying the columns already relocated if one
+	// throws. The copies are made first so that if one throws, no column has been moved from yet.
+	template <bool Copy, std::size_t I>
+	auto relocate(soa_vector& grown) -> typename std::enable_if<(I < sizeof...(Ts))>::type {
+		typedef std::integral_constant<bool, relocated_by_copy<I>::value == Copy> relocated;
+		relocate_column<I>(grown, relocated{});
+		try {
+			relocate<Copy, I + 1>(grown);
+		} catch(...) {
+			grown.template destroy_column<I>(mSize, relocated{});
+			throw;
+		}
+	}
+
+	template <bool Copy, std::size_t I>
+	auto relocate(soa_vector&) noexcept -> typename std::enable_if<(I == sizeof...(Ts))>::type {
+	}
+
+	template <std::size_t I>
+	void relocate_column(soa_vector& grown, std::true_type) {
+		column_t<I>* const from = column<I>();
+		relocate_column(from, from + mSize, grown.template column<I>(),
+		                std::integral_constant<bool, !relocated_by_copy<I>::value>{});
+	}
+
+	template <std::size_t I>
+	void relocate_column(soa_vector&, std::false_type) noexcept {
+	}
+
+	template <std::size_t I>
+	void destroy_column(std::size_t n, std::true_type) noexcept {
+		typedef column_t<I> T;
+		for(std::size_t i = 0; i < n; ++i) {
+			column<I>()[i].~T();
+		}
+	}
+
+	template <std::size_t I>
+	void destroy_column(std::size_t, std::false_type) noexcept {
+	}
+
+	template <std::size_t... Is>
+	void destroy_copied_columns(std::size_t n, std::index_sequence<Is...>) noexcept {
+		detail::swallow{0, (destroy_column<Is>(n, relocated_by_copy<Is>{}), 0)...};
+	}
+
+	template <typename T>
+	static void relocate_column(T* first, T* last, T* out, std::true_type) {
+		std::uninitialized_copy(std::make_move_iterator(first), std::make_move_iterator(last), out);
+	}
+
+	template <typename T>
+	static void relocate_column(T* first, T* last, T* out, std::false_type) {
+		std::uninitialized_copy(first, last, out);
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,180 @@
+/******************************************************************//**
+ * \file   string_switch.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_DDC62EF5_A4C4_4FB8_B59A_4694EDB37712
+#define INCLUDE_GUARD_DDC62EF5_A4C4_4FB8_B59A_4694EDB37712
+
+// Calls the handler of whichever of a list of string literals matches a string, using a perfect hash
+// of the literals that is built at compile time
+
+#include "vta/core.hpp"
+#include "vta/perfect_hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/** An empty object whose type has a static data() returning the string literal s and a static size()
+    returning its length, so that s can be used in constant expressions by a template. */
+#define VTA_STRING(s) ([] { \
+	static_assert(std::is_array<std::remove_reference_t<decltype(s)>>::value, "VTA_STRING takes a string literal"); \
+	struct vta_string { \
+		constexpr static char const* data() noexcept { \
+			return s; \
+		} \
+		constexpr static std::size_t size() noexcept { \
+			return sizeof(s) - 1; \
+		} \
+	}; \
+	return vta_string{}; \
+}())
+
+namespace vta {
+
+/** A string created by VTA_STRING and the function to call when it is matched. */
+template <typename String, typename Function>
+class string_case_f {
+	Function mF;
+
+public:
+	typedef String string;
+
+	constexpr string_case_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	VTA_ALWAYS_INLINE constexpr decltype(auto) operator()() const
+	  noexcept(noexcept(std::declval<Function const&>()())) {
+		return mF();
+	}
+
+	VTA_ALWAYS_INLINE constexpr decltype(auto) operator()()
+	  noexcept(noexcept(std::declval<Function&>()())) {
+		return mF();
+	}
+};
+
+template <typename String, typename Function>
+constexpr string_case_f<String, typename std::remove_reference<Function>::type> string_case(String, Function&& f)
+  noexcept(std::is_nothrow_constructible<string_case_f<String, typename std::remove_reference<Function>::type>,
+                                         Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+namespace detail {
+
+constexpr bool equal_strings(char const* lhs, std::size_t lhs_size, char const* rhs, std::size_t rhs_size) noexcept {
+	if(lhs_size != rhs_size) {
+		return false;
+	}
+	for(std::size_t i = 0; i < lhs_size; ++i) {
+		if(lhs[i] != rhs[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename... Strings>
+struct string_table {
+	static constexpr std::size_t count = sizeof...(Strings);
+
+	// Padded with an empty string so that there is no array of size 0
+	static constexpr char const* data[] = {Strings::data()..., ""};
+	static constexpr std::size_t sizes[] = {Strings::size()..., 0};
+	static constexpr perfect_hash<count> table
+	  = make_perfect_hash<count>({hash_bytes(Strings::data(), Strings::size())..., 0});
+
+	constexpr static bool unique() noexcept {
+		for(std::size_t i = 0; i < count; ++i) {
+			for(std::size_t j = i + 1; j < count; ++j) {
+				if(equal_strings(data[i], sizes[i], data[j], sizes[j])) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// The hash picks the only literal that can match, which is then compared in full
+	VTA_ALWAYS_INLINE static int find(char const* s, std::size_t size) noexcept {
+		int const i = table.find(hash_bytes(s, size));
+		return i >= 0 && sizes[i] == size && std::memcmp(s, data[i], size) == 0 ? i : -1;
+	}
+};
+
+template <typename... Strings>
+constexpr std::size_t string_table<Strings...>::count;
+
+template <typename... Strings>
+constexpr char const* string_table<Strings...>::data[];
+
+template <typename... Strings>
+constexpr std::size_t string_table<Strings...>::sizes[];
+
+template <typename... Strings>
+constexpr perfect_hash<string_table<Strings...>::count> string_table<Strings...>::table;
+
+template <std::size_t I, typename Cases>
+void call_case(Cases& cases) {
+	std::get<I>(cases)();
+}
+
+template <typename Cases, std::size_t... Is>
+VTA_ALWAYS_INLINE void call_case(Cases& cases, int i, std::index_sequence<Is...>) {
+	typedef void (*case_function)(Cases&);
+	static case_function const calls[] = {&call_case<Is, Cases>..., nullptr};
+	calls[i](cases);
+}
+
+}
+
+/** Calls the case whose string is equal to input, which has data() and size() members, and returns
+    whether there was one. */
+template <typename Input, typename... Cases>
+bool string_switch(Input const& input, Cases&&... cases) {
+	typedef detail::string_table<typename std::decay_t<Cases>::string...> strings;
+	static_assert(strings::unique(), "The strings of a string_switch must be unique");
+	static_assert(!strings::unique() || strings::table.placed, "Two strings of the string_switch have the same hash");
+
+	int const i = strings::find(input.data(), input.size());
+	if(i < 0) {
+		return false;
+	}
+	auto refs = std::forward_as_tuple(cases...);
+	detail::call_case(refs, i, std::index_sequence_for<Cases...>{});
+	return true;
+}
+
+}
+
+#endif
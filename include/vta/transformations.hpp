@@ -0,0 +1,855 @@
+/******************************************************************//**
+ * \file   transformations.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_7905CB14_BF2B_49E4_ACA2_7C04F3F05BC7
+#define INCLUDE_GUARD_7905CB14_BF2B_49E4_ACA2_7C04F3F05BC7
+
+// Transformations that select and reorder arguments before forwarding them on, and forward_after
+
+#include "vta/core.hpp"
+#include "vta/predicates.hpp"
+#include "vta/unpack.hpp"
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/**************************************************************************************************
+ * Transformations                                                                                *
+ **************************************************************************************************/
+
+VTA_INSTRUMENTED_BEGIN
+
+template <typename Function, typename Transformation>
+class forward_after_f {
+	Function mF;
+
+public:
+	constexpr forward_after_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const
+	  noexcept(noexcept(Transformation::transform(mF, std::forward<Args>(args)...))) {
+		VTA_PROBE(detail::type_name<Transformation>(), sizeof...(Args));
+		return Transformation::transform(mF, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args)
+	  noexcept(noexcept(Transformation::transform(mF, std::forward<Args>(args)...))) {
+		VTA_PROBE(detail::type_name<Transformation>(), sizeof...(Args));
+		return Transformation::transform(mF, std::forward<Args>(args)...);
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args) const
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+
+	template <typename Tuple>
+	VTA_ALWAYS_INLINE constexpr auto operator()(unpacked<Tuple>&& args)
+	  noexcept(noexcept(detail::call_unpacked(*this, std::move(args)))) {
+		return detail::call_unpacked(*this, std::move(args));
+	}
+};
+
+template <typename Transformation, typename Function>
+constexpr forward_after_f<Function, Transformation> forward_after(Function&& f)
+  noexcept(std::is_nothrow_constructible<forward_after_f<Function, Transformation>, Function&&>::value) {
+	return {std::forward<Function>(f)};
+}
+
+VTA_INSTRUMENTED_END
+
+namespace detail {
+
+template <int... Ns>
+struct index_list {};
+
+template <typename... Ts>
+struct type_list {};
+
+template <typename... Ts>
+struct voider {
+	typedef void type;
+};
+
+// Calls f with the arguments at positions Map::source(0, Size), ..., Map::source(Count - 1, Size) of
+// refs. The arguments are picked out by index, so a transformation is a single call however it
+// rearranges its arguments.
+template <typename Map, int Size, typename Function, typename Refs, int... Ks>
+VTA_ALWAYS_INLINE constexpr auto gather_refs(std::integer_sequence<int, Ks...>, Function&& f, Refs const& refs)
+  noexcept(noexcept(std::forward<Function>(f)(get_ref<Map::source(Ks, Size)>(refs)...))) {
+	return std::forward<Function>(f)(get_ref<Map::source(Ks, Size)>(refs)...);
+}
+
+template <typename Map, int Count>
+struct gather {
+	typedef Map map;
+	static int const count = Count;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(gather_refs<Map, sizeof...(Args)>(
+	    std::make_integer_sequence<int, Count>{},
+	    std::forward<Function>(f),
+	    ref_pack<std::make_integer_sequence<int, sizeof...(Args)>, Args...>{std::forward<Args>(args)...}))) {
+		return gather_refs<Map, sizeof...(Args)>(
+		  std::make_integer_sequence<int, Count>{},
+		  std::forward<Function>(f),
+		  ref_pack<std::make_integer_sequence<int, sizeof...(Args)>, Args...>{std::forward<Args>(args)...});
+	}
+};
+
+// The maps below give the position of the argument that is forwarded as the k-th argument, when
+// there are size arguments in total
+
+template <int N>
+struct rotate_map {
+	constexpr static int source(int k, int size) noexcept {
+		return (k + N % size + size) % size;
+	}
+};
+
+// Keeps the first argument fixed and rotates the rest
+template <int N>
+struct rotate_tail_map {
+	constexpr static int source(int k, int size) noexcept {
+		return k == 0 ? 0 : 1 + rotate_map<N>::source(k - 1, size - 1);
+	}
+};
+
+template <int Begin>
+struct offset_map {
+	constexpr static int source(int k, int) noexcept {
+		return Begin + k;
+	}
+};
+
+template <int A, int B>
+struct swap_map {
+	constexpr static int source(int k, int) noexcept {
+		return k == A ? B : k == B ? A : k;
+	}
+};
+
+// Equivalent to swapping First with each of Rest... in turn, so the swaps are undone in reverse
+// order to find where an argument came from
+template <int First, int... Rest>
+struct cycle_map {
+	constexpr static int source(int k, int size) noexcept {
+		int const rest[] = {Rest...};
+		int const first = (First + size) % size;
+		for(int i = static_cast<int>(sizeof...(Rest)) - 1; i >= 0; --i) {
+			int const other = (rest[i] + size) % size;
+			k = k == first ? other : k == other ? first : k;
+		}
+		return k;
+	}
+};
+
+struct reverse_map {
+	constexpr static int source(int k, int size) noexcept {
+		return size - 1 - k;
+	}
+};
+
+template <int... Ns>
+struct position_map {
+	constexpr static int source(int k, int size) noexcept {
+		int const positions[] = {Ns..., 0};
+		return (positions[k] + size) % size;
+	}
+};
+
+// Forwards the k-th argument for which Passes... is true
+template <bool... Passes>
+struct filter_map {
+	constexpr static int count() noexcept {
+		bool const passes[] = {Passes..., false};
+		int n = 0;
+		for(bool passed : passes) {
+			n += passed ? 1 : 0;
+		}
+		return n;
+	}
+
+	constexpr static int source(int k, int) noexcept {
+		bool const passes[] = {Passes..., false};
+		for(int i = 0; i < static_cast<int>(sizeof...(Passes)); ++i) {
+			if(passes[i] && k-- == 0) {
+				return i;
+			}
+		}
+		return -1;
+	}
+};
+
+// Applies Second to the SecondSize arguments that First picked out of FirstSize arguments
+template <typename First, int FirstSize, typename Second, int SecondSize>
+struct then_map {
+	constexpr static int source(int k, int) noexcept {
+		return First::source(Second::source(k, SecondSize), FirstSize);
+	}
+};
+
+template <typename Map, typename Types, typename Indices>
+struct gathered_types;
+
+template <typename Map, typename... Types, int... Ks>
+struct gathered_types<Map, type_list<Types...>, std::integer_sequence<int, Ks...>> {
+	typedef type_list<typename std::tuple_element<Map::source(Ks, sizeof...(Types)),
+	                                              std::tuple<Types...>>::type...> type;
+};
+
+// Folds the index maps of Transforms... into Map, which picks arguments of the types Types... out of
+// Size arguments. Has no type member if one of the transformations does not have indices.
+template <typename Map, int Size, typename Types, typename Transforms, typename = void>
+struct fuse {};
+
+template <typename Map, int Size, typename... Types>
+struct fuse<Map, Size, type_list<Types...>, type_list<>, void> {
+	typedef gather<Map, sizeof...(Types)> type;
+};
+
+// One step of fuse, which composes the index map of Transform with Map
+template <typename Map, int Size, typename Transform, typename... Types>
+struct fuse_step {
+	typedef typename Transform::template indices<Types...> Step;
+	typedef typename gathered_types<typename Step::map,
+	                                type_list<Types...>,
+	                                std::make_integer_sequence<int, Step::count>>::type types;
+	// A step after the identity map needs no composition, which keeps the names of the fused maps
+	// short, but only if no earlier step has changed the number of arguments that Step's map sees
+	typedef typename std::conditional<std::is_same<Map, offset_map<0>>::value
+	                                    && static_cast<int>(sizeof...(Types)) == Size,
+	                                  typename Step::map,
+	                                  then_map<Map, Size, typename Step::map, sizeof...(Types)>>::type map;
+};
+
+template <typename Map, int Size, typename... Types, typename Transform, typename... Transforms>
+struct fuse<Map, Size,
+            type_list<Types...>,
+            type_list<Transform, Transforms...>,
+            typename voider<typename Transform::template indices<Types...>>::type>
+  : fuse<typename fuse_step<Map, Size, Transform, Types...>::map,
+         Size,
+         typename fuse_step<Map, Size, Transform, Types...>::types,
+         type_list<Transforms...>> {
+};
+
+VTA_INSTRUMENTED_BEGIN
+
+template <typename Function, typename... Transforms>
+class compose_helper_f;
+
+template <typename Function, typename FirstTransform, typename... Transforms>
+class compose_helper_f<Function, FirstTransform, Transforms...> {
+	Function mF;
+
+public:
+	constexpr compose_helper_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const
+	  noexcept(noexcept(FirstTransform::transform(compose_helper_f<Function, Transforms...>{mF},
+	                                              std::forward<Args>(args)...))) {
+		VTA_PROBE(detail::type_name<FirstTransform>(), sizeof...(Args));
+		return FirstTransform::transform(compose_helper_f<Function, Transforms...>{mF},
+		                                 std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args)
+	  noexcept(noexcept(FirstTransform::transform(compose_helper_f<Function, Transforms...>{mF},
+	                                              std::forward<Args>(args)...))) {
+		VTA_PROBE(detail::type_name<FirstTransform>(), sizeof...(Args));
+		return FirstTransform::transform(compose_helper_f<Function, Transforms...>{mF},
+		                                 std::forward<Args>(args)...);
+	}
+};
+
+template <typename Function>
+class compose_helper_f<Function> {
+	Function mF;
+
+public:
+	constexpr compose_helper_f(Function f) noexcept(std::is_nothrow_move_constructible<Function>::value)
+	: mF(std::move(f)) {
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const noexcept(noexcept(mF(std::forward<Args>(args)...))) {
+		return mF(std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	VTA_ALWAYS_INLINE constexpr auto operator()(Args&&... args) noexcept(noexcept(mF(std::forward<Args>(args)...))) {
+		return mF(std::forward<Args>(args)...);
+	}
+};
+
+// Applies the transformations one after the other, for pipelines that cannot be fused
+template <typename... Transforms>
+struct nested_compose {
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(compose_helper_f<typename std::remove_reference<Function>::type,
+	                                     Transforms...>{f}(std::forward<Args>(args)...))) {
+		typedef compose_helper_f<typename std::remove_reference<Function>::type, Transforms...> Helper;
+		return Helper{f}(std::forward<Args>(args)...);
+	}
+};
+
+VTA_INSTRUMENTED_END
+
+template <typename Transform, typename Types, typename Fallback, typename = void>
+struct indices_or {
+	typedef Fallback type;
+};
+
+template <typename Transform, typename... Args, typename Fallback>
+struct indices_or<Transform,
+                  type_list<Args...>,
+                  Fallback,
+                  typename voider<typename Transform::template indices<Args...>>::type> {
+	typedef typename Transform::template indices<Args...> type;
+};
+
+// N counted backwards from Size if it is negative
+template <int N, int Size>
+struct from_end {
+	static int const value = N < 0 ? N + Size : N;
+};
+
+}
+
+VTA_INSTRUMENTED_BEGIN
+
+/** Composes a sequence of transformations. If every transformation only selects and reorders the
+    arguments, the pipeline is fused into a single step, unless VTA_INSTRUMENT is 1 so that each step
+    can report itself. */
+template <typename... Transforms>
+struct compose {
+	template <typename... Args>
+	using indices = typename detail::fuse<detail::offset_map<0>,
+	                                      sizeof...(Args),
+	                                      detail::type_list<Args...>,
+	                                      detail::type_list<Transforms...>>::type;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(impl<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return impl<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+
+private:
+#if VTA_INSTRUMENT
+	template <typename...>
+	using impl = detail::nested_compose<Transforms...>;
+#else
+	template <typename... Args>
+	using impl = typename detail::indices_or<compose,
+	                                         detail::type_list<Args...>,
+	                                         detail::nested_compose<Transforms...>>::type;
+#endif
+};
+
+VTA_INSTRUMENTED_END
+
+/** Forwards the arguments to f without change. */
+struct id {
+	template <typename... Args>
+	using indices = detail::gather<detail::offset_map<0>, sizeof...(Args)>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(std::forward<Function>(f)(std::forward<Args>(args)...))) {
+		return std::forward<Function>(f)(std::forward<Args>(args)...);
+	}
+};
+
+/** Calls the function with the given arguments if Condition is true. */
+template <bool Condition>
+struct call_if;
+
+template <>
+struct call_if<true> {
+	template <typename... Args>
+	using indices = id::indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(id::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return id::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <>
+struct call_if<false> {
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static void transform(Function&&, Args&&...) noexcept {
+	}
+};
+
+/** Flips the first two variables. */
+struct flip {
+	template <typename... Args>
+	struct indices : detail::gather<detail::swap_map<0, 1>, sizeof...(Args)> {
+		static_assert(sizeof...(Args) >= 2, "Cannot flip fewer than two parameters");
+	};
+
+	template <typename Function, typename First, typename Second, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, First&& first, Second&& second, Args&&... rest)
+	  noexcept(noexcept(std::forward<Function>(f)(std::forward<Second>(second),
+	                                              std::forward<First>(first),
+	                                              std::forward<Args>(rest)...))) {
+		return std::forward<Function>(f)(std::forward<Second>(second),
+		                                 std::forward<First>(first),
+		                                 std::forward<Args>(rest)...);
+	}
+};
+
+/** Left cyclic shifts the parameters \a n places. */
+template <unsigned N>
+struct left_shift {
+	template <typename... Args>
+	struct indices : detail::gather<detail::rotate_map<N>, sizeof...(Args)> {
+		static_assert(N == 0 || N < sizeof...(Args),
+		  "Cannot left shift more than the size of the parameter pack");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Right cyclic shifts the parameters \a n places. */
+template <unsigned N>
+struct right_shift {
+	template <typename... Args>
+	struct indices : detail::gather<detail::rotate_map<-static_cast<int>(N)>, sizeof...(Args)> {
+		static_assert(N == 0 || N < sizeof...(Args),
+		  "Cannot right shift more than the size of the parameter pack");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <int N, bool NotNegative = (N >= 0)>
+struct shift;
+
+template <int N>
+struct shift<N, true> {
+	template <typename... Args>
+	using indices = typename left_shift<N>::template indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(left_shift<N>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return left_shift<N>::transform(std::forward<Function>(f),
+		                                std::forward<Args>(args)...);
+	}
+};
+
+template <int N>
+struct shift<N, false> {
+	template <typename... Args>
+	using indices = typename right_shift<-N>::template indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(right_shift<-N>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return right_shift<-N>::transform(std::forward<Function>(f),
+		                                  std::forward<Args>(args)...);
+	}
+};
+
+/** Left cyclic shifts the tail of the parameters \a n places. */
+template <unsigned N>
+struct left_shift_tail {
+	template <typename... Args>
+	struct indices : detail::gather<detail::rotate_tail_map<N>, sizeof...(Args)> {
+		static_assert(N == 0 || static_cast<int>(N) < static_cast<int>(sizeof...(Args)) - 1,
+		  "Cannot left shift more than the size of the tail of the parameter pack");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Right cyclic shifts the tail of the parameters \a n places. */
+template <unsigned N>
+struct right_shift_tail {
+	template <typename... Args>
+	struct indices : detail::gather<detail::rotate_tail_map<-static_cast<int>(N)>, sizeof...(Args)> {
+		static_assert(N == 0 || static_cast<int>(N) < static_cast<int>(sizeof...(Args)) - 1,
+		  "Cannot right shift more than the size of the tail of the parameter pack");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <int N, bool NotNegative = (N >= 0)>
+struct shift_tail;
+
+template <int N>
+struct shift_tail<N, true> {
+	template <typename... Args>
+	using indices = typename left_shift_tail<N>::template indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(left_shift_tail<N>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return left_shift_tail<N>::transform(std::forward<Function>(f),
+		                                     std::forward<Args>(args)...);
+	}
+};
+
+template <int N>
+struct shift_tail<N, false> {
+	template <typename... Args>
+	using indices = typename right_shift_tail<-N>::template indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(right_shift_tail<-N>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return right_shift_tail<-N>::transform(std::forward<Function>(f),
+		                                       std::forward<Args>(args)...);
+	}
+};
+
+/** Drops the first N arguments. */
+template <int N>
+struct drop {
+	template <typename... Args>
+	struct indices : detail::gather<detail::offset_map<detail::from_end<N, sizeof...(Args)>::value>,
+	                                sizeof...(Args) - detail::from_end<N, sizeof...(Args)>::value> {
+		static_assert(-static_cast<int>(sizeof...(Args)) <= N && N <= static_cast<int>(sizeof...(Args)),
+		  "Cannot drop more variables than are passed");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Passes only the first N arguments. */
+template <int N>
+struct take {
+	template <typename... Args>
+	struct indices : detail::gather<detail::offset_map<0>, detail::from_end<N, sizeof...(Args)>::value> {
+		static_assert(-static_cast<int>(sizeof...(Args)) <= N && N <= static_cast<int>(sizeof...(Args)),
+		  "Cannot take more parameters that are available");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Take only the arguments at positions N, N + 1, ..., M - 1, M */
+template <int N, int M>
+struct slice {
+	template <typename... Args>
+	struct indices : detail::gather<detail::offset_map<detail::modulus<N, sizeof...(Args)>::value>,
+	                                detail::modulus<M, sizeof...(Args)>::value
+	                                  - detail::modulus<N, sizeof...(Args)>::value + 1> {
+		static_assert(-static_cast<int>(sizeof...(Args)) <= N && N < static_cast<int>(sizeof...(Args)),
+		  "N is out of bounds");
+		static_assert(-static_cast<int>(sizeof...(Args)) <= M && M < static_cast<int>(sizeof...(Args)),
+		  "M is out of bounds");
+		static_assert(detail::modulus<N, sizeof...(Args)>::value <= detail::modulus<M, sizeof...(Args)>::value,
+		  "N must be <= M");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Swap the parameters in the positions \a n and \a m. If a number is negative, it is counted from
+    the end of the parameter pack. e.g. -1 would be the last parameter. */
+template <int N, int M>
+struct swap {
+	template <typename... Args>
+	struct indices : detail::gather<detail::swap_map<detail::modulus<N, sizeof...(Args)>::value,
+	                                                 detail::modulus<M, sizeof...(Args)>::value>,
+	                                sizeof...(Args)> {
+		static_assert(-static_cast<int>(sizeof...(Args)) <= N && N < static_cast<int>(sizeof...(Args)),
+		  "N is out of bounds");
+		static_assert(-static_cast<int>(sizeof...(Args)) <= M && M < static_cast<int>(sizeof...(Args)),
+		  "M is out of bounds");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <int... Positions>
+struct cycle;
+
+template <>
+struct cycle<> {
+	template <typename... Args>
+	using indices = id::indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(id::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return id::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <int First>
+struct cycle<First> {
+	template <typename... Args>
+	using indices = id::indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(id::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return id::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+template <int First, int Second, int... Rest>
+struct cycle<First, Second, Rest...> {
+	template <typename... Args>
+	struct indices : detail::gather<detail::cycle_map<First, Second, Rest...>, sizeof...(Args)> {
+		static_assert(vta::are_unique_ints<detail::modulus<First, sizeof...(Args)>::value,
+		                                   detail::modulus<Second, sizeof...(Args)>::value,
+		                                   detail::modulus<Rest, sizeof...(Args)>::value...>::value,
+		  "The positions to permute must be unique");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+namespace detail {
+
+// Returns the index of Value in Ns..., or -1 if it does not appear
+template <int Value, int... Ns>
+constexpr int position_of() noexcept {
+	int const positions[] = {Ns..., 0};
+	for(int i = 0; i < static_cast<int>(sizeof...(Ns)); ++i) {
+		if(positions[i] == Value) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+}
+
+/** Forwards the parameter at position Ns[i] as the i-th parameter. If a position is negative, it is
+    counted from the end of the parameter pack. */
+template <int... Ns>
+struct permute {
+	template <typename... Args>
+	struct indices : detail::gather<detail::position_map<Ns...>, sizeof...(Ns)> {
+		static_assert(sizeof...(Ns) == sizeof...(Args),
+		  "There must be exactly one position for each parameter");
+		static_assert(vta::are_unique_ints<detail::modulus<Ns, sizeof...(Args)>::value...>::value,
+		  "The positions to permute must be unique");
+	};
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+
+private:
+	template <typename Indices>
+	struct inverse_helper;
+
+	template <int... Is>
+	struct inverse_helper<std::integer_sequence<int, Is...>> {
+		typedef permute<detail::position_of<Is, detail::modulus<Ns, sizeof...(Ns)>::value...>()...> type;
+	};
+
+public:
+	/** The permutation that restores the original order of the parameters. */
+	typedef typename inverse_helper<std::make_integer_sequence<int, sizeof...(Ns)>>::type inverse;
+};
+
+/** Reverse the order of arguments */
+struct reverse {
+	template <typename... Args>
+	using indices = detail::gather<detail::reverse_map, sizeof...(Args)>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+/** Filter in parameters only if Predicate<Arg>::value is true for each argument type. */
+template <template <class> class Predicate>
+struct filter {
+	template <typename... Args>
+	using indices = detail::gather<detail::filter_map<Predicate<Args>::value...>,
+	                               detail::filter_map<Predicate<Args>::value...>::count()>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return indices<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+namespace detail {
+
+template <template <class, class> class Compare,
+          typename Types,
+          typename Left,
+          typename Right,
+          typename Merged = index_list<>>
+struct merge_indices;
+
+template <template <class, class> class Compare, typename Types, int... Rs, int... Ms>
+struct merge_indices<Compare, Types, index_list<>, index_list<Rs...>, index_list<Ms...>> {
+	typedef index_list<Ms..., Rs...> type;
+};
+
+template <template <class, class> class Compare, typename Types, int L, int... Ls, int... Ms>
+struct merge_indices<Compare, Types, index_list<L, Ls...>, index_list<>, index_list<Ms...>> {
+	typedef index_list<Ms..., L, Ls...> type;
+};
+
+template <template <class, class> class Compare,
+          typename Types,
+          int L, int... Ls,
+          int R, int... Rs,
+          int... Ms>
+struct merge_indices<Compare, Types, index_list<L, Ls...>, index_list<R, Rs...>, index_list<Ms...>> {
+	// Only take from the right if it is strictly ordered before the left to keep the sort stable
+	typedef typename std::conditional<Compare<typename std::tuple_element<R, Types>::type,
+	                                          typename std::tuple_element<L, Types>::type>::value,
+	                                  merge_indices<Compare,
+	                                                Types,
+	                                                index_list<L, Ls...>,
+	                                                index_list<Rs...>,
+	                                                index_list<Ms..., R>>,
+	                                  merge_indices<Compare,
+	                                                Types,
+	                                                index_list<Ls...>,
+	                                                index_list<R, Rs...>,
+	                                                index_list<Ms..., L>>
+	                                 >::type::type type;
+};
+
+template <template <class, class> class Compare,
+          typename Types,
+          int Begin,
+          int End,
+          bool Split = (End - Begin > 1)>
+struct sort_indices {
+	typedef typename merge_indices<Compare,
+	                               Types,
+	                               typename sort_indices<Compare, Types, Begin, (Begin + End) / 2>::type,
+	                               typename sort_indices<Compare, Types, (Begin + End) / 2, End>::type
+	                              >::type type;
+};
+
+template <template <class, class> class Compare, typename Types, int Begin, int End>
+struct sort_indices<Compare, Types, Begin, End, false> {
+	typedef typename std::conditional<(Begin < End), index_list<Begin>, index_list<>>::type type;
+};
+
+template <typename Indices>
+struct permute_from;
+
+template <int... Ns>
+struct permute_from<index_list<Ns...>> {
+	typedef permute<Ns...> type;
+};
+
+}
+
+/** Stable sorts the parameters so that an argument of type A is forwarded before an argument of type
+    B if Compare<A, B>::value is true. */
+template <template <class, class> class Compare>
+struct sort_by {
+	template <typename... Args>
+	using permutation = typename detail::permute_from<
+	  typename detail::sort_indices<Compare, std::tuple<Args...>, 0, sizeof...(Args)>::type
+	>::type;
+
+	template <typename... Args>
+	using inverse = typename permutation<Args...>::inverse;
+
+	template <typename... Args>
+	using indices = typename permutation<Args...>::template indices<Args...>;
+
+	template <typename Function, typename... Args>
+	VTA_ALWAYS_INLINE constexpr static auto transform(Function&& f, Args&&... args)
+	  noexcept(noexcept(permutation<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...))) {
+		return permutation<Args...>::transform(std::forward<Function>(f), std::forward<Args>(args)...);
+	}
+};
+
+}
+
+#endif
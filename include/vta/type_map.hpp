@@ -0,0 +1,179 @@
+/******************************************************************//**
+ * \file   type_map.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_364FFE6A_4D8E_4BBA_A052_88F2B5FCCA17
+#define INCLUDE_GUARD_364FFE6A_4D8E_4BBA_A052_88F2B5FCCA17
+
+// A value for each type of a closed set, found by a dense index at compile time or by a perfect hash
+// of a type id at run time
+
+#include "vta/core.hpp"
+#include "vta/functions.hpp"
+#include "vta/perfect_hash.hpp"
+#include "vta/predicates.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+/** Passes a type to a function as a value. */
+template <typename T>
+struct type_tag {
+	typedef T type;
+};
+
+/** An identifier for T computed at compile time from its name, which is the same in every translation
+    unit built by the same compiler. */
+template <typename T>
+constexpr std::uint64_t type_id() noexcept {
+#if defined(_MSC_VER)
+	return detail::mix(detail::hash_string(__FUNCSIG__));
+#else
+	return detail::mix(detail::hash_string(__PRETTY_FUNCTION__));
+#endif
+}
+
+/** Holds a Value for each of the unique types Ts... */
+template <typename Value, typename... Ts>
+class type_map {
+	static_assert(are_unique<Ts...>::value, "The types of a type_map must be unique");
+
+	typedef detail::index_table_for<Ts...> indices;
+	typedef detail::perfect_hash<sizeof...(Ts)> hash_table;
+
+	static constexpr hash_table table = detail::make_perfect_hash<sizeof...(Ts)>({type_id<Ts>()..., 0});
+	static_assert(table.placed, "Two types of the type_map have the same type_id");
+
+	std::array<Value, sizeof...(Ts)> mValues;
+
+public:
+	constexpr type_map() noexcept(std::is_nothrow_default_constructible<Value>::value)
+	: mValues{} {
+	}
+
+	explicit type_map(Value const& value) noexcept(std::is_nothrow_copy_assignable<Value>::value) {
+		mValues.fill(value);
+	}
+
+	constexpr static std::size_t size() noexcept {
+		return sizeof...(Ts);
+	}
+
+	/** The position of T in Ts... */
+	template <typename T>
+	constexpr static std::size_t index_of() noexcept {
+		static_assert(detail::has_unique_index<T, indices>::value, "T is not one of the types of the type_map");
+		return decltype(detail::index_in<T>(std::declval<indices>()))::value;
+	}
+
+	/** The position of the type whose type_id is id, or -1 if there is none. */
+	VTA_ALWAYS_INLINE constexpr static int find_index(std::uint64_t id) noexcept {
+		return table.find(id);
+	}
+
+	template <typename T>
+	VTA_ALWAYS_INLINE constexpr Value& get() noexcept {
+		return std::get<index_of<T>()>(mValues);
+	}
+
+	template <typename T>
+	VTA_ALWAYS_INLINE constexpr Value const& get() const noexcept {
+		return std::get<index_of<T>()>(mValues);
+	}
+
+	/** The value of the type whose type_id is id, or nullptr if there is none. */
+	VTA_ALWAYS_INLINE Value* find(std::uint64_t id) noexcept {
+		int const i = find_index(id);
+		return i < 0 ? nullptr : mValues.data() + i;
+	}
+
+	VTA_ALWAYS_INLINE Value const* find(std::uint64_t id) const noexcept {
+		int const i = find_index(id);
+		return i < 0 ? nullptr : mValues.data() + i;
+	}
+
+	/** Calls f(type_tag<T>{}, value) for the type T whose type_id is id, and returns whether there was
+	    one. */
+	template <typename Function>
+	bool visit(std::uint64_t id, Function&& f) {
+		return visit_impl(*this, id, f, std::index_sequence_for<Ts...>{});
+	}
+
+	template <typename Function>
+	bool visit(std::uint64_t id, Function&& f) const {
+		return visit_impl(*this, id, f, std::index_sequence_for<Ts...>{});
+	}
+
+	/** Calls f(type_tag<T>{}, value) for each type T in order. */
+	template <typename Function>
+	VTA_ALWAYS_INLINE constexpr void for_each(Function&& f) {
+		for_each_impl(*this, f, std::index_sequence_for<Ts...>{});
+	}
+
+	template <typename Function>
+	VTA_ALWAYS_INLINE constexpr void for_each(Function&& f) const {
+		for_each_impl(*this, f, std::index_sequence_for<Ts...>{});
+	}
+
+private:
+	template <typename Map, typename Function, std::size_t... Is>
+	VTA_ALWAYS_INLINE constexpr static void for_each_impl(Map& map, Function& f, std::index_sequence<Is...>) {
+		detail::swallow{0, (static_cast<void>(f(type_tag<Ts>{}, std::get<Is>(map.mValues))), 0)...};
+	}
+
+	template <typename T, std::size_t I, typename Map, typename Function>
+	static void visit_one(Map& map, Function& f) {
+		f(type_tag<T>{}, std::get<I>(map.mValues));
+	}
+
+	// A table of one function for each type, indexed by the perfect hash, so that the call is a single
+	// indirect jump whatever the number of types
+	template <typename Map, typename Function, std::size_t... Is>
+	static bool visit_impl(Map& map, std::uint64_t id, Function& f, std::index_sequence<Is...>) {
+		typedef void (*visitor)(Map&, Function&);
+		static visitor const visitors[] = {&type_map::visit_one<Ts, Is, Map, Function>..., nullptr};
+		int const i = find_index(id);
+		if(i < 0) {
+			return false;
+		}
+		visitors[i](map, f);
+		return true;
+	}
+};
+
+template <typename Value, typename... Ts>
+constexpr typename type_map<Value, Ts...>::hash_table type_map<Value, Ts...>::table;
+
+}
+
+#endif
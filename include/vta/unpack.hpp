@@ -0,0 +1,102 @@
+/******************************************************************//**
+ * \file   unpack.hpp
+ * \author Elliot Goodrich
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *********************************************************************/
+
+#ifndef INCLUDE_GUARD_7C4B6BDD_46D8_4BAF_B0D2_ADB4138917D1
+#define INCLUDE_GUARD_7C4B6BDD_46D8_4BAF_B0D2_ADB4138917D1
+
+// Calls functions with the elements of a tuple-like, and the marker that lets the adaptors do so
+
+#include "vta/core.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace vta {
+
+namespace detail {
+
+// std::get is brought in at namespace scope so that the exception specification of apply_helper sees
+// it as well, while get for tuple-likes outside of std is still found by argument dependent lookup
+namespace adl {
+
+using std::get;
+
+template <typename Function, typename Tuple, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr auto apply_helper(Function&& f, Tuple&& t, std::index_sequence<Is...>)
+  noexcept(noexcept(std::forward<Function>(f)(get<Is>(std::forward<Tuple>(t))...))) {
+	return std::forward<Function>(f)(get<Is>(std::forward<Tuple>(t))...);
+}
+
+}
+
+template <typename Tuple>
+using tuple_indices = std::make_index_sequence<std::tuple_size<typename std::decay<Tuple>::type>::value>;
+
+}
+
+/** Stands in for the whole argument list of an adaptor, which is then called with the elements of the
+    tuple-like instead. It refers to the tuple-like, so it must not outlive the call. */
+template <typename Tuple>
+struct unpacked {
+	Tuple&& tuple;
+};
+
+template <typename Tuple>
+VTA_ALWAYS_INLINE constexpr unpacked<Tuple> unpack(Tuple&& t) noexcept {
+	return {std::forward<Tuple>(t)};
+}
+
+namespace detail {
+
+namespace adl {
+
+template <typename Function, typename Tuple, std::size_t... Is>
+VTA_ALWAYS_INLINE constexpr decltype(auto) call_unpacked(Function&& f, unpacked<Tuple>&& args, std::index_sequence<Is...>)
+  noexcept(noexcept(std::forward<Function>(f)(get<Is>(std::forward<Tuple>(args.tuple))...))) {
+	return std::forward<Function>(f)(get<Is>(std::forward<Tuple>(args.tuple))...);
+}
+
+}
+
+// Lets an adaptor take unpacked<Tuple> by calling itself with the elements, each of which has the
+// value category of the tuple-like. The result is returned as it is, so that accumulate_into still
+// returns a reference.
+template <typename Function, typename Tuple>
+VTA_ALWAYS_INLINE constexpr decltype(auto) call_unpacked(Function&& f, unpacked<Tuple>&& args)
+  noexcept(noexcept(adl::call_unpacked(std::forward<Function>(f), std::move(args), tuple_indices<Tuple>{}))) {
+	return adl::call_unpacked(std::forward<Function>(f), std::move(args), tuple_indices<Tuple>{});
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,20 @@
+// The named module vta, which exports the same API as vta/algorithms.hpp. Macros cannot be exported
+// from a module, so code that uses VTA_FN_TO_FUNCTOR, VTA_RESTRICT or VTA_UNROLL must still include
+// the header.
+
+module;
+
+// The standard headers are included before the module declaration so that they stay attached to the
+// global module, and their include guards make the includes inside vta/algorithms.hpp no-ops
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+export module vta;
+
+export {
+#include "vta/algorithms.hpp"
+}
@@ -1,27 +1,20 @@
 #include "vta/algorithms.hpp"
 
+#include "printer.hpp"
+
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
+#include <memory>
 #include <type_traits>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace {
 
-struct printer {
-	printer(std::ostream& str)
-	: m_str{&str} {
-	}
-
-	template <typename T>
-	void operator()(T const& obj) {
-		*m_str << obj;
-	}
-
-	std::ostream* m_str;
-};
-
 struct string_concat {
 	template <typename LHS, typename RHS>
 	std::string operator()(LHS const& lhs, RHS const& rhs) const {
@@ -60,6 +53,90 @@ struct adjacent_printer {
 	std::string* m_str;
 };
 
+int allocations = 0;
+
+template <typename T>
+struct counting_allocator {
+	typedef T value_type;
+
+	counting_allocator() = default;
+
+	template <typename U>
+	counting_allocator(counting_allocator<U> const&) {
+	}
+
+	T* allocate(std::size_t n) {
+		++allocations;
+		return std::allocator<T>{}.allocate(n);
+	}
+
+	void deallocate(T* p, std::size_t n) {
+		std::allocator<T>{}.deallocate(p, n);
+	}
+
+	bool operator==(counting_allocator const&) const {
+		return true;
+	}
+
+	bool operator!=(counting_allocator const&) const {
+		return false;
+	}
+};
+
+template <bool NoThrow>
+struct first_of {
+	template <typename Arg, typename... Args>
+	constexpr Arg operator()(Arg arg, Args&&...) const noexcept(NoThrow) {
+		return arg;
+	}
+};
+
+// Every adaptor and transformation is noexcept exactly when calling the wrapped function is
+template <bool NoThrow>
+void check_noexcept() {
+	first_of<NoThrow> const f{};
+	int i = 0;
+	int j = 0;
+	std::tuple<int, int> const t{1, 2};
+
+	static_assert(noexcept(vta::forward_after<vta::flip>(f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::compose<vta::flip, vta::reverse>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::id::transform(f, 1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::call_if<true>::transform(f, 1)) == NoThrow, "");
+	static_assert(noexcept(vta::call_if<false>::transform(f, 1)), "");
+	static_assert(noexcept(vta::flip::transform(f, 1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::left_shift<1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::right_shift<1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::shift<-1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::left_shift_tail<1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::right_shift_tail<1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::shift_tail<-1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::drop<1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::take<2>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::slice<1, 2>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::swap<0, -1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::cycle<0, 1, 2>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::permute<2, 0, 1>::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::reverse::transform(f, 1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::filter<std::is_integral>::transform(f, 1, 2.0, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::sort_by<vta::greater_size>::transform(f, 'a', 1)) == NoThrow, "");
+
+	static_assert(noexcept(vta::map(f)), "");
+	static_assert(noexcept(vta::map(f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::adjacent_map<2>(f)(1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::foldl(f)(1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::foldr(f)(1, 2, 3)) == NoThrow, "");
+	static_assert(noexcept(vta::accumulate_into(i, f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::all_of(f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::any_of(f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::none_of(f)(1, 2)) == NoThrow, "");
+	static_assert(noexcept(vta::batch(f)(1u, &i, &j)) == NoThrow, "");
+	static_assert(noexcept(vta::apply(f, t)) == NoThrow, "");
+	static_assert(noexcept(vta::map(f)(vta::unpack(t))) == NoThrow, "");
+	static_assert(noexcept(vta::foldl(f)(vta::unpack(t))) == NoThrow, "");
+	static_assert(noexcept(vta::forward_after<vta::flip>(f)(vta::unpack(t))) == NoThrow, "");
+}
+
 }
 
 BOOST_AUTO_TEST_SUITE(algorithms)
@@ -127,6 +204,8 @@ BOOST_AUTO_TEST_CASE(last) {
 	BOOST_CHECK_EQUAL(vta::last(0, 1), 1);
 	BOOST_CHECK_EQUAL(vta::last(0, 1, 2), 2);
 	BOOST_CHECK_EQUAL(vta::last(1, "2", 3), 3);
+	BOOST_CHECK_EQUAL(vta::last(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20), 20);
+	BOOST_CHECK_EQUAL(*vta::last(1, std::unique_ptr<int>{new int{2}}), 2);
 }
 
 BOOST_AUTO_TEST_CASE(at) {
@@ -138,6 +217,7 @@ BOOST_AUTO_TEST_CASE(at) {
 	BOOST_CHECK_EQUAL(vta::at<-2>(1, '2', 3u, 4.5, "six"), 4.5);
 	BOOST_CHECK_EQUAL(vta::at<4>(1, '2', 3u, 4.5, "six"), std::string{"six"});
 	BOOST_CHECK_EQUAL(vta::at<-1>(1, '2', 3u, 4.5, "six"), std::string{"six"});
+	BOOST_CHECK_EQUAL(vta::at<12>(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13), 12);
 }
 
 BOOST_AUTO_TEST_CASE(head_t) {
@@ -537,6 +617,80 @@ BOOST_AUTO_TEST_CASE(filter) {
 	}
 }
 
+BOOST_AUTO_TEST_CASE(permute) {
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::permute<>>(vta::map(printer{ss}))();
+		BOOST_CHECK_EQUAL(ss.str(), "");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::permute<0, 1, 2, 3, 4>>(vta::map(printer{ss}))(1, '2', 3u, 4.5, "six");
+		BOOST_CHECK_EQUAL(ss.str(), "1234.5six");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::permute<4, 2, 0, 1, 3>>(vta::map(printer{ss}))(1, '2', 3u, 4.5, "six");
+		BOOST_CHECK_EQUAL(ss.str(), "six3124.5");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::permute<-1, 2, 0, 1, -2>>(vta::map(printer{ss}))(1, '2', 3u, 4.5, "six");
+		BOOST_CHECK_EQUAL(ss.str(), "six3124.5");
+	}
+
+	{
+		std::stringstream ss;
+		typedef vta::permute<4, 2, 0, 1, 3> p;
+		vta::forward_after<vta::compose<p, p::inverse>>(vta::map(printer{ss}))(1, '2', 3u, 4.5, "six");
+		BOOST_CHECK_EQUAL(ss.str(), "1234.5six");
+	}
+
+	static_assert(std::is_same<vta::permute<2, 0, 1>::inverse, vta::permute<1, 2, 0>>::value, "");
+	static_assert(std::is_same<vta::permute<-1, 0, 1>::inverse, vta::permute<1, 2, 0>>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(sort_by) {
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::sort_by<vta::greater_size>>(vta::map(printer{ss}))();
+		BOOST_CHECK_EQUAL(ss.str(), "");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::sort_by<vta::greater_size>>(vta::map(printer{ss}))(1);
+		BOOST_CHECK_EQUAL(ss.str(), "1");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::sort_by<vta::greater_size>>(vta::map(printer{ss}))('1', 2, '3', 4.5);
+		BOOST_CHECK_EQUAL(ss.str(), "4.5213");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::sort_by<vta::greater_alignment>>(vta::map(printer{ss}))(1, '2', 3u, 4.5, "six");
+		BOOST_CHECK_EQUAL(ss.str(), "4.5132six");
+	}
+
+	{
+		std::stringstream ss;
+		typedef vta::sort_by<vta::greater_size> sort;
+		vta::forward_after<vta::compose<sort, sort::inverse<char, int, char, double>>>(vta::map(printer{ss}))('1', 2, '3', 4.5);
+		BOOST_CHECK_EQUAL(ss.str(), "1234.5");
+	}
+
+	static_assert(std::is_same<vta::sort_by<vta::greater_size>::permutation<char, int, char, double>,
+	                           vta::permute<3, 1, 0, 2>>::value, "");
+	static_assert(std::is_same<vta::sort_by<vta::greater_size>::inverse<char, int, char, double>,
+	                           vta::permute<2, 1, 3, 0>>::value, "");
+}
+
 // Functions
 
 BOOST_AUTO_TEST_CASE(map) {
@@ -550,12 +704,28 @@ BOOST_AUTO_TEST_CASE(adjacent_map) {
 	adjacent_printer printer{s};
 	vta::adjacent_map<2>(std::ref(printer))(1, 2, 3, 4, 5, 6);
 	BOOST_CHECK_EQUAL(s, "26122030");
+
+	std::stringstream ss;
+	vta::adjacent_map<3>([&ss](int i, int j, int k) { ss << i << j << k << ' '; })(1, 2, 3, 4, 5);
+	BOOST_CHECK_EQUAL(ss.str(), "123 234 345 ");
+
+	// Only the first argument of each window is forwarded, as no later window uses it
+	std::string categories;
+	auto const category = [](auto&& x) { return std::is_lvalue_reference<decltype(x)>::value ? 'l' : 'r'; };
+	vta::adjacent_map<2>([&](auto&& a, auto&& b) {
+		categories += category(std::forward<decltype(a)>(a));
+		categories += category(std::forward<decltype(b)>(b));
+	})(1, 2, 3);
+	BOOST_CHECK_EQUAL(categories, "rlrl");
 }
 
 BOOST_AUTO_TEST_CASE(foldl) {
 	auto s = string_concat{};
 	auto const result = vta::foldl(s)(1, 2, 3);
 	BOOST_CHECK_EQUAL(result, "123");
+
+	// Long enough to take several steps at each level of the fold
+	BOOST_CHECK_EQUAL(vta::foldl(s)(1, '2', 3u, "4", 5, 6, 7, 8, 9, 10, 11), "1234567891011");
 }
 
 BOOST_AUTO_TEST_CASE(foldr) {
@@ -563,6 +733,41 @@ BOOST_AUTO_TEST_CASE(foldr) {
 	BOOST_CHECK_EQUAL(vta::foldr(minus)(1), 1);
 	BOOST_CHECK_EQUAL(vta::foldr(minus)(1, 2), -1);
 	BOOST_CHECK_EQUAL(vta::foldr(minus)(1, 2, 3), 2);
+	BOOST_CHECK_EQUAL(vta::foldr(minus)(1, 2, 3, 4, 5, 6, 7, 8, 9, 10), -5);
+	BOOST_CHECK_EQUAL(vta::foldr(minus)(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11), 6);
+}
+
+BOOST_AUTO_TEST_CASE(accumulate_into) {
+	{
+		int total = 0;
+		auto const add = [](int& acc, int x){ acc += x; };
+		BOOST_CHECK_EQUAL(vta::accumulate_into(total, add)(), 0);
+		BOOST_CHECK_EQUAL(vta::accumulate_into(total, add)(1, 2, 3), 6);
+		BOOST_CHECK_EQUAL(total, 6);
+	}
+
+	{
+		typedef std::basic_string<char, std::char_traits<char>, counting_allocator<char>> string;
+		auto const append = [](string& acc, auto const& x){ acc += x; };
+		auto const size = [](char const* x){ return std::char_traits<char>::length(x); };
+
+		string str;
+		allocations = 0;
+		vta::accumulate_into(str, append, size)("a string that is ", "too long ", "for the small ", "string optimization");
+		BOOST_CHECK_EQUAL(str, "a string that is too long for the small string optimization");
+		BOOST_CHECK_EQUAL(allocations, 1);
+	}
+
+	{
+		std::vector<int, counting_allocator<int>> v;
+		auto const push_back = [](std::vector<int, counting_allocator<int>>& acc, int x){ acc.push_back(x); };
+
+		allocations = 0;
+		vta::accumulate_into(v, push_back, [](int){ return 1; })(1, 2, 3, 4, 5);
+		BOOST_CHECK_EQUAL(v.size(), 5u);
+		BOOST_CHECK_EQUAL(v[4], 5);
+		BOOST_CHECK_EQUAL(allocations, 1);
+	}
 }
 
 BOOST_AUTO_TEST_CASE(compose) {
@@ -577,6 +782,65 @@ BOOST_AUTO_TEST_CASE(compose) {
 		vta::forward_after<vta::compose<vta::left_shift<1>, vta::flip>>(vta::map(printer{ss}))(0, 1, 2, 3, 4);
 		BOOST_CHECK_EQUAL(ss.str(), "21340");
 	}
+
+	{
+		// The filter sees the types that are left after the drop and the reverse
+		std::stringstream ss;
+		typedef vta::compose<vta::drop<1>, vta::reverse, vta::filter<std::is_integral>, vta::shift<1>> pipeline;
+		vta::forward_after<pipeline>(vta::map(printer{ss}))(0, 1, 2.5, 3, '4', 5.5);
+		BOOST_CHECK_EQUAL(ss.str(), "314");
+	}
+
+	{
+		std::stringstream ss;
+		typedef vta::compose<vta::compose<vta::swap<0, -1>, vta::cycle<0, 1, 2>>, vta::compose<>, vta::slice<1, 3>> pipeline;
+		vta::forward_after<pipeline>(vta::map(printer{ss}))(0, 1, 2, 3, 4);
+		BOOST_CHECK_EQUAL(ss.str(), "413");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::compose<vta::reverse, vta::call_if<false>>>(vta::map(printer{ss}))(0, 1, 2);
+		BOOST_CHECK_EQUAL(ss.str(), "");
+	}
+}
+
+BOOST_AUTO_TEST_CASE(compose_fuses_pipelines) {
+	// reverse, drop<1> and flip pick the arguments 0 and 1 of 0, 1, 2 in a single step
+	typedef vta::compose<vta::reverse, vta::drop<1>, vta::flip>::indices<int, int, int> fused;
+	static_assert(fused::count == 2, "");
+	static_assert(fused::map::source(0, 3) == 0, "");
+	static_assert(fused::map::source(1, 3) == 1, "");
+
+	std::stringstream ss;
+	fused::transform(vta::map(printer{ss}), 0, 1, 2);
+	BOOST_CHECK_EQUAL(ss.str(), "01");
+
+	// A step that keeps the first arguments in place but drops the others still changes the size that
+	// the maps after it are computed from
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::compose<vta::take<2>, vta::reverse>>(vta::map(printer{ss}))(1, 2, 3, 4, 5);
+		BOOST_CHECK_EQUAL(ss.str(), "21");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::compose<vta::take<3>, vta::left_shift<1>>>(vta::map(printer{ss}))(1, 2, 3, 4, 5);
+		BOOST_CHECK_EQUAL(ss.str(), "231");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::compose<vta::take<2>, vta::call_if<true>, vta::reverse>>(vta::map(printer{ss}))(1, 2, 3, 4, 5);
+		BOOST_CHECK_EQUAL(ss.str(), "21");
+	}
+
+	{
+		std::stringstream ss;
+		vta::forward_after<vta::compose<vta::take<4>, vta::compose<>, vta::cycle<0, -1>>>(vta::map(printer{ss}))(1, 2, 3, 4, 5);
+		BOOST_CHECK_EQUAL(ss.str(), "4231");
+	}
 }
 
 BOOST_AUTO_TEST_CASE(swap) {
@@ -641,6 +905,100 @@ BOOST_AUTO_TEST_CASE(none_of) {
 	BOOST_CHECK_EQUAL(vta::none_of(is_positive_int{})(), true);
 }
 
+BOOST_AUTO_TEST_CASE(unpack) {
+	{
+		std::stringstream ss;
+		auto const t = std::make_tuple(1, ' ', 2.5);
+		vta::map(printer{ss})(vta::unpack(t));
+		vta::forward_after<vta::reverse>(vta::map(printer{ss}))(vta::unpack(std::make_pair('a', 3)));
+		BOOST_CHECK_EQUAL(ss.str(), "1 2.53a");
+	}
+
+	{
+		std::array<int, 4> const a{{1, 2, 3, 4}};
+		auto minus = [](auto l, auto r){ return l - r; };
+		BOOST_CHECK_EQUAL(vta::foldl(minus)(vta::unpack(a)), -8);
+		BOOST_CHECK_EQUAL(vta::foldr(minus)(vta::unpack(a)), -2);
+		BOOST_CHECK_EQUAL(vta::all_of(is_positive_int{})(vta::unpack(a)), true);
+		BOOST_CHECK_EQUAL(vta::any_of(is_positive_int{})(vta::unpack(std::tuple<>{})), false);
+		BOOST_CHECK_EQUAL(vta::none_of(is_positive_int{})(vta::unpack(a)), false);
+
+		std::vector<int> v;
+		vta::accumulate_into(v, [](std::vector<int>& acc, int x){ acc.push_back(x); })(vta::unpack(a));
+		BOOST_CHECK_EQUAL(v.size(), 4u);
+
+		std::string s;
+		adjacent_printer adjacent{s};
+		vta::adjacent_map<2>(std::ref(adjacent))(vta::unpack(a));
+		BOOST_CHECK_EQUAL(s, "2612");
+	}
+
+	{
+		// The elements keep the value category of the tuple, so an rvalue tuple is moved from
+		auto t = std::make_tuple(std::make_unique<int>(1), std::make_unique<int>(2));
+		std::vector<std::unique_ptr<int>> v;
+		vta::map([&v](std::unique_ptr<int>&& p){ v.push_back(std::move(p)); })(vta::unpack(std::move(t)));
+		BOOST_CHECK(std::get<0>(t) == nullptr);
+		BOOST_CHECK(std::get<1>(t) == nullptr);
+		BOOST_REQUIRE_EQUAL(v.size(), 2u);
+		BOOST_CHECK_EQUAL(*v[1], 2);
+
+		// and an lvalue tuple is referred to
+		auto u = std::make_tuple(1, 2);
+		vta::map([](int& x){ x *= 10; })(vta::unpack(u));
+		BOOST_CHECK(u == std::make_tuple(10, 20));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(batch) {
+	std::vector<int> a{1, 2, 3};
+	std::vector<char> b{'4', '5', '6'};
+	std::array<double, 3> c{{7.5, 8.5, 9.5}};
+
+	{
+		std::stringstream ss;
+		vta::batch(vta::map(printer{ss}))(a, b, c);
+		BOOST_CHECK_EQUAL(ss.str(), "147.5258.5369.5");
+	}
+
+	{
+		std::stringstream ss;
+		vta::batch<vta::reverse>(vta::map(printer{ss}))(a, b, c);
+		BOOST_CHECK_EQUAL(ss.str(), "7.5418.5529.563");
+	}
+
+	{
+		std::stringstream ss;
+		vta::batch<vta::compose<vta::drop<1>, vta::flip>>(vta::map(printer{ss}))(2u, a.data(), b.data(), c.data());
+		BOOST_CHECK_EQUAL(ss.str(), "7.548.55");
+	}
+
+	{
+		std::stringstream ss;
+		vta::batch(vta::map(printer{ss}))(0u, a.data(), b.data());
+		BOOST_CHECK_EQUAL(ss.str(), "");
+	}
+
+	vta::batch([](int& x, double y){ x *= static_cast<int>(y); })(a, c);
+	BOOST_CHECK_EQUAL(a[0], 7);
+	BOOST_CHECK_EQUAL(a[1], 16);
+	BOOST_CHECK_EQUAL(a[2], 27);
+}
+
+BOOST_AUTO_TEST_CASE(noexcept_specification) {
+	check_noexcept<true>();
+	check_noexcept<false>();
+
+	std::string const str;
+	static_assert(noexcept(vta::head(1, str)), "");
+	static_assert(!noexcept(vta::head(str, 1)), "");
+	static_assert(noexcept(vta::last(str, 1)), "");
+	static_assert(!noexcept(vta::last(1, str)), "");
+	static_assert(noexcept(vta::at<1>(str, 1, str)), "");
+	static_assert(!noexcept(vta::at<-1>(str, 1, str)), "");
+	static_assert(!noexcept(vta::foldl(first_of<true>{})(str, 1)), "");
+}
+
 BOOST_AUTO_TEST_CASE(macro) {
 	BOOST_CHECK_EQUAL(vta::foldl(VTA_FN_TO_FUNCTOR(std::max))(0, 1, 4, 2), 4);
 }
@@ -0,0 +1,127 @@
+#include "vta/bits.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct is_odd {
+	constexpr bool operator()(int x) const {
+		return x % 2 != 0;
+	}
+};
+
+struct first_and_last {
+	template <typename... Bools>
+	constexpr int operator()(bool first, Bools... bools) const {
+		bool const values[] = {first, bools...};
+		return first * 10 + values[sizeof...(Bools)];
+	}
+};
+
+struct collect {
+	std::vector<bool>* out;
+
+	template <typename... Bools>
+	void operator()(Bools... bools) const {
+		*out = {bools...};
+	}
+};
+
+// Bit k of the pattern that the tests pack, so that every block of a mask holds different bits
+constexpr bool pattern(std::size_t k) {
+	return (k * 7 + k / 3) % 5 < 2;
+}
+
+template <std::size_t... Is>
+vta::bitmask_t<sizeof...(Is)> pack_pattern(std::index_sequence<Is...>) {
+	return vta::pack_bits(pattern(Is)...);
+}
+
+template <std::size_t... Is>
+vta::bitmask_t<sizeof...(Is)> mask_pattern(std::index_sequence<Is...>) {
+	return vta::mask_of([](std::size_t k){ return pattern(k); })(Is...);
+}
+
+template <std::size_t N>
+std::bitset<N> expected_pattern() {
+	std::bitset<N> bits;
+	for(std::size_t k = 0; k < N; ++k) {
+		bits[k] = pattern(k);
+	}
+	return bits;
+}
+
+template <std::size_t N>
+void check_pattern() {
+	auto const packed = pack_pattern(std::make_index_sequence<N>{});
+	BOOST_CHECK(std::bitset<N>{packed} == expected_pattern<N>());
+	BOOST_CHECK(std::bitset<N>{mask_pattern(std::make_index_sequence<N>{})} == expected_pattern<N>());
+
+	std::vector<bool> unpacked;
+	vta::unpack_bits<N>(packed, collect{&unpacked});
+	BOOST_REQUIRE_EQUAL(unpacked.size(), N);
+	for(std::size_t k = 0; k < N; ++k) {
+		BOOST_CHECK_EQUAL(unpacked[k], pattern(k));
+	}
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(bits)
+
+BOOST_AUTO_TEST_CASE(pack_bits) {
+	static_assert(vta::pack_bits() == 0, "");
+	static_assert(vta::pack_bits(true) == 1, "");
+	static_assert(vta::pack_bits(true, false, true, true) == 0xd, "");
+	static_assert(vta::pack_bits(true, false, false, false, false, false, false, false, true) == 0x101, "");
+	static_assert(vta::pack_bits(true, true, true, true, true, true, true, true, true, true, true, true, true, true,
+	                             true, true, false, true) == 0x2ffff, "");
+	static_assert(std::is_same<decltype(vta::pack_bits(true, false)), std::uint64_t>::value, "");
+	static_assert(std::is_same<vta::bitmask_t<64>, std::uint64_t>::value, "");
+	static_assert(std::is_same<vta::bitmask_t<65>, std::bitset<65>>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(unpack_bits) {
+	static_assert(vta::unpack_bits<3>(0x5, first_and_last{}) == 11, "");
+	static_assert(vta::unpack_bits<3>(0x6, first_and_last{}) == 1, "");
+	static_assert(vta::unpack_bits<1>(0x6, first_and_last{}) == 0, "");
+
+	std::vector<bool> unpacked;
+	vta::unpack_bits<2>(0xff, collect{&unpacked});
+	BOOST_CHECK((unpacked == std::vector<bool>{true, true}));
+}
+
+BOOST_AUTO_TEST_CASE(mask_of) {
+	static_assert(vta::mask_of(is_odd{})(1, 2, 3, 4, 5) == 0x15, "");
+	static_assert(vta::mask_of(is_odd{})(1, 2, 3, 4, 5, 6, 7, 8, 9) == 0x155, "");
+	static_assert(vta::mask_of(is_odd{})() == 0, "");
+
+	// The predicate is called on the arguments in order
+	std::vector<int> calls;
+	vta::mask_of([&](int x){ calls.push_back(x); return true; })(1, 2, 3);
+	BOOST_CHECK((calls == std::vector<int>{1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(every_size) {
+	check_pattern<7>();
+	check_pattern<8>();
+	check_pattern<15>();
+	check_pattern<16>();
+	check_pattern<31>();
+	check_pattern<33>();
+	check_pattern<63>();
+	check_pattern<64>();
+	check_pattern<65>();
+	check_pattern<100>();
+	check_pattern<128>();
+	check_pattern<512>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,106 @@
+#include "vta/compare.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+enum class colour : short {
+	red = -1,
+	green = 2
+};
+
+struct point {
+	int x;
+	int y;
+};
+
+}
+
+namespace vta {
+
+template <>
+struct is_contiguously_hashable<point> : std::true_type {
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(compare)
+
+BOOST_AUTO_TEST_CASE(compare_is_lexicographic) {
+	static_assert(vta::compare(std::make_tuple(1, 2), std::make_tuple(1, 2)) == 0, "");
+	static_assert(vta::compare(std::make_tuple(1, 2), std::make_tuple(1, 3)) == -1, "");
+	static_assert(vta::compare(std::make_tuple(2, 0), std::make_tuple(1, 3)) == 1, "");
+	static_assert(vta::compare(std::make_tuple(), std::make_tuple()) == 0, "");
+
+	// Signed values and enumerations keep their order once they are packed
+	static_assert(vta::compare(std::make_tuple(short(-1), 'a'), std::make_tuple(short(0), 'a')) == -1, "");
+	static_assert(vta::compare(std::make_tuple(colour::red), std::make_tuple(colour::green)) == -1, "");
+	static_assert(vta::compare(std::make_tuple(true, false), std::make_tuple(false, true)) == 1, "");
+
+	// Elements that do not fit in the rest of a word start the next one
+	static_assert(vta::compare(std::make_tuple('a', std::int64_t{1} << 60, 'b'),
+	                           std::make_tuple('a', std::int64_t{1} << 60, 'c')) == -1, "");
+	static_assert(vta::compare(std::make_tuple('a', std::int64_t{2}, 'b'),
+	                           std::make_tuple('a', std::int64_t{1} << 60, 'a')) == -1, "");
+}
+
+BOOST_AUTO_TEST_CASE(compare_stops_at_the_first_difference) {
+	using namespace std::string_literals;
+	BOOST_CHECK_EQUAL(vta::compare(std::make_tuple(1, "b"s, 2.5), std::make_tuple(1, "a"s, 1.5)), 1);
+	BOOST_CHECK_EQUAL(vta::compare(std::make_tuple(1, "a"s, 2.5), std::make_tuple(1, "a"s, 3.5)), -1);
+	BOOST_CHECK_EQUAL(vta::compare(std::make_tuple(0, "b"s, 2u), std::make_tuple(1, "a"s, 1u)), -1);
+	BOOST_CHECK_EQUAL(vta::compare(std::make_tuple(1, "a"s, 2u), std::make_tuple(1, "a"s, 1u)), 1);
+
+	// Elements of different types are compared with operator<
+	BOOST_CHECK_EQUAL(vta::compare(std::make_tuple(1, 2L), std::make_tuple(1L, 2)), 0);
+	BOOST_CHECK_EQUAL(vta::compare(std::make_pair(2, 'a'), std::make_tuple(1L, 'a')), 1);
+}
+
+BOOST_AUTO_TEST_CASE(compare_agrees_with_tuple) {
+	std::mt19937 eng{42};
+	std::uniform_int_distribution<int> value{-3, 3};
+	for(int i = 0; i < 10000; ++i) {
+		auto const lhs = std::make_tuple(char(value(eng)), short(value(eng)), std::int64_t{value(eng)} << 40,
+		                                 unsigned(value(eng)), std::to_string(value(eng)), bool(value(eng) > 0));
+		auto const rhs = std::make_tuple(char(value(eng)), short(value(eng)), std::int64_t{value(eng)} << 40,
+		                                 unsigned(value(eng)), std::to_string(value(eng)), bool(value(eng) > 0));
+		int const expected = lhs < rhs ? -1 : rhs < lhs ? 1 : 0;
+		BOOST_CHECK_EQUAL(vta::compare(lhs, rhs), expected);
+		BOOST_CHECK_EQUAL(vta::compare(lhs, lhs), 0);
+		BOOST_CHECK_EQUAL(vta::equal(lhs, rhs), lhs == rhs);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(equal_compares_every_element) {
+	static_assert(vta::equal(std::make_tuple(1, 'a', colour::red), std::make_tuple(1, 'a', colour::red)), "");
+	static_assert(!vta::equal(std::make_tuple(1, 'a', colour::red), std::make_tuple(1, 'a', colour::green)), "");
+	static_assert(vta::equal(std::make_tuple(), std::make_tuple()), "");
+
+	int x = 0;
+	int y = 0;
+	BOOST_CHECK(vta::equal(std::make_tuple(&x, point{1, 2}, std::string("a")), std::make_tuple(&x, point{1, 2}, std::string("a"))));
+	BOOST_CHECK(!vta::equal(std::make_tuple(&x, point{1, 2}), std::make_tuple(&y, point{1, 2})));
+	BOOST_CHECK(!vta::equal(std::make_tuple(&x, point{1, 2}), std::make_tuple(&x, point{2, 1})));
+	BOOST_CHECK(!vta::equal(std::make_tuple(1, std::string("a")), std::make_tuple(1, std::string("b"))));
+
+	// Floating point numbers are compared with operator==
+	BOOST_CHECK(vta::equal(std::make_tuple(0.0), std::make_tuple(-0.0)));
+	BOOST_CHECK(vta::equal(std::make_tuple(1, 2L), std::make_tuple(1L, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(as_function_objects) {
+	std::array<int, 3> const a = {{1, 2, 3}};
+	std::array<int, 3> const b = {{1, 3, 0}};
+	BOOST_CHECK_EQUAL(vta::compare_f{}(a, b), -1);
+	BOOST_CHECK(!vta::equal_f{}(a, b));
+	BOOST_CHECK(vta::equal_f{}(a, std::make_tuple(1, 2, 3)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
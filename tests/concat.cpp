@@ -0,0 +1,49 @@
+#include "vta/concat.hpp"
+#include "vta/functions.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+#include <sstream>
+#include <string>
+
+namespace {
+
+template <typename... Args>
+std::string stream(Args const&... args) {
+	std::ostringstream ss;
+	vta::map([&ss](auto const& x){ ss << x; })(args...);
+	return ss.str();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(concat)
+
+BOOST_AUTO_TEST_CASE(strings) {
+	std::string const name = "World";
+	char const* const pointer = "pointer";
+	char buffer[16] = "buffer";
+	BOOST_CHECK_EQUAL(vta::concat(), "");
+	BOOST_CHECK_EQUAL(vta::concat("Hello ", name, '!'), "Hello World!");
+	BOOST_CHECK_EQUAL(vta::concat(pointer, ' ', buffer), "pointer buffer");
+}
+
+BOOST_AUTO_TEST_CASE(numbers) {
+	BOOST_CHECK_EQUAL(vta::concat(0), "0");
+	BOOST_CHECK_EQUAL(vta::concat(42, ' ', -7, ' ', 0u), "42 -7 0");
+	BOOST_CHECK_EQUAL(vta::concat(LLONG_MIN), stream(LLONG_MIN));
+	BOOST_CHECK_EQUAL(vta::concat(ULLONG_MAX), stream(ULLONG_MAX));
+	BOOST_CHECK_EQUAL(vta::concat(static_cast<short>(-12)), "-12");
+	BOOST_CHECK_EQUAL(vta::concat(3.25, ' ', 1e300, ' ', -0.1f), stream(3.25, ' ', 1e300, ' ', -0.1f));
+	BOOST_CHECK_EQUAL(vta::concat(1.0 / 3.0), stream(1.0 / 3.0));
+}
+
+BOOST_AUTO_TEST_CASE(append) {
+	std::string str = "x = ";
+	BOOST_CHECK_EQUAL(vta::append(str, 1, ", y = ", 2.5), "x = 1, y = 2.5");
+	BOOST_CHECK_EQUAL(str, "x = 1, y = 2.5");
+	BOOST_CHECK_EQUAL(str.size(), 14u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,240 @@
+#include "vta/algorithms.hpp"
+#include "vta/bits.hpp"
+#include "vta/compare.hpp"
+#include "vta/hash.hpp"
+#include "vta/numeric.hpp"
+#include "vta/packed_tuple.hpp"
+#include "vta/rpn.hpp"
+#include "vta/scan.hpp"
+#include "vta/type_map.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Every entry of API_REFERENCE.md is checked here with static_assert, so this file only has to
+// compile for the tests to pass. The exceptions are batch, append, concat, merge, memoize,
+// soa_vector and string_switch, which work on memory that only exists at run time, function_ref,
+// which erases the type of what it refers to, and VTA_FN_TO_FUNCTOR and VTA_STRING, as lambdas
+// cannot appear in constant expressions before C++17.
+
+namespace {
+
+// Returns the arguments as the digits of a decimal number, so that the order they arrive in can be
+// checked
+struct digits {
+	template <typename... Args>
+	constexpr int operator()(Args... args) const {
+		int const values[] = {0, static_cast<int>(args)...};
+		int result = 0;
+		for(int value : values) {
+			result = result * 10 + value;
+		}
+		return result;
+	}
+};
+
+struct plus {
+	template <typename T, typename U>
+	constexpr auto operator()(T lhs, U rhs) const {
+		return lhs + rhs;
+	}
+};
+
+struct minus {
+	template <typename T, typename U>
+	constexpr auto operator()(T lhs, U rhs) const {
+		return lhs - rhs;
+	}
+};
+
+struct is_positive {
+	template <typename T>
+	constexpr bool operator()(T t) const {
+		return t > 0;
+	}
+};
+
+struct append_digit {
+	int* out;
+
+	constexpr void operator()(int digit) const {
+		*out = *out * 10 + digit;
+	}
+};
+
+struct append_digit_to {
+	constexpr void operator()(int& out, int digit) const {
+		out = out * 10 + digit;
+	}
+};
+
+struct one {
+	constexpr std::size_t operator()(int) const {
+		return 1;
+	}
+};
+
+constexpr int map_digits() {
+	int result = 0;
+	vta::map(append_digit{&result})(1, 2, 3);
+	return result;
+}
+
+constexpr int accumulate_digits() {
+	int result = 0;
+	vta::accumulate_into(result, append_digit_to{})(1, 2);
+	return vta::accumulate_into(result, append_digit_to{}, one{})(3);
+}
+
+constexpr bool call_if_false() {
+	vta::call_if<false>::transform(digits{}, 1, 2);
+	return true;
+}
+
+constexpr int restrict_sum(int const* VTA_RESTRICT values, int n) {
+	int result = 0;
+	VTA_UNROLL
+	for(int i = 0; i < n; ++i) {
+		result += values[i];
+	}
+	return result;
+}
+
+constexpr int type_map_get() {
+	vta::type_map<int, char, int> m;
+	m.get<int>() = 3;
+	return m.get<int>();
+}
+
+constexpr int values[] = {1, 2, 3, 4};
+
+}
+
+BOOST_AUTO_TEST_SUITE(compile_time)
+
+BOOST_AUTO_TEST_CASE(predicates) {
+	static_assert(vta::are_same<int, int, int>::value, "");
+	static_assert(vta::are_same_after<std::decay, int, int const&, int&&>::value, "");
+	static_assert(vta::are_unique<int, char, double>::value, "");
+	static_assert(!vta::are_unique_after<std::decay, int, int const&>::value, "");
+	static_assert(vta::are_unique_ints<0, 1, 2>::value, "");
+	static_assert(vta::greater_alignment<double, char>::value, "");
+	static_assert(vta::greater_size<int, char>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(miscellaneous_functions) {
+	static_assert(vta::head(1, 2, 3) == 1, "");
+	static_assert(vta::last(1, 2, 3) == 3, "");
+	static_assert(vta::at<1>(1, 2, 3) == 2, "");
+	static_assert(vta::at<-1>(1, 2, 3) == 3, "");
+	static_assert(vta::add_const(vta::foldl(plus{}))(1, 2) == 3, "");
+	static_assert(vta::apply(digits{}, std::make_tuple(1, 2, 3)) == 123, "");
+	static_assert(vta::apply(digits{}, std::make_pair(1, 2)) == 12, "");
+	static_assert(vta::forward_after<vta::reverse>(digits{})(vta::unpack(std::make_tuple(1, 2, 3))) == 321, "");
+	static_assert(vta::foldl(minus{})(vta::unpack(std::make_pair(10, 1))) == 9, "");
+	static_assert(vta::all_of(is_positive{})(vta::unpack(std::make_tuple(1, 2.5))), "");
+	static_assert(vta::hash(1, 'a') != vta::hash('a', 1), "");
+	static_assert(vta::hash_after<vta::reverse>(1, 'a') == vta::hash('a', 1), "");
+	static_assert(vta::hash_f{}(vta::unpack(std::make_tuple(1, 'a'))) == vta::hash(1, 'a'), "");
+	static_assert(vta::compare(std::make_tuple(1, 'a'), std::make_tuple(1, 'b')) == -1, "");
+	static_assert(vta::compare_f{}(std::make_pair(2, 'a'), std::make_tuple(1, 'b')) == 1, "");
+	static_assert(vta::equal(std::make_tuple(1, 'a'), std::make_pair(1, 'a')), "");
+	static_assert(!vta::equal_f{}(std::make_tuple(1, 'a'), std::make_tuple(1, 'b')), "");
+}
+
+BOOST_AUTO_TEST_CASE(type_aliases) {
+	static_assert(std::is_same<vta::head_t<int, char>, int>::value, "");
+	static_assert(std::is_same<vta::last_t<int, char>, char>::value, "");
+	static_assert(std::is_same<vta::at_t<1>::type<int, char, double>, char>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(variadic_functors) {
+	static_assert(map_digits() == 123, "");
+	static_assert(vta::foldl(minus{})(10, 1, 2) == 7, "");
+	static_assert(vta::foldr(minus{})(10, 1, 2) == 11, "");
+	static_assert(accumulate_digits() == 123, "");
+	static_assert(vta::all_of(is_positive{})(1, 2, 3), "");
+	static_assert(vta::any_of(is_positive{})(-1, 0, 3), "");
+	static_assert(vta::none_of(is_positive{})(-1, 0, -3), "");
+	static_assert(vta::forward_after<vta::flip>(digits{})(1, 2, 3) == 213, "");
+	static_assert(std::get<2>(vta::scanl(minus{})(10, 1, 2)) == 7, "");
+	static_assert(std::get<0>(vta::scanr(minus{})(10, 1, 2)) == 11, "");
+}
+
+BOOST_AUTO_TEST_CASE(transformations) {
+	static_assert(vta::id::transform(digits{}, 1, 2, 3) == 123, "");
+	static_assert(vta::call_if<true>::transform(digits{}, 1, 2) == 12, "");
+	static_assert(call_if_false(), "");
+	static_assert(vta::flip::transform(digits{}, 1, 2, 3) == 213, "");
+	static_assert(vta::left_shift<1>::transform(digits{}, 1, 2, 3) == 231, "");
+	static_assert(vta::right_shift<1>::transform(digits{}, 1, 2, 3) == 312, "");
+	static_assert(vta::shift<-2>::transform(digits{}, 1, 2, 3) == 231, "");
+	static_assert(vta::left_shift_tail<1>::transform(digits{}, 1, 2, 3, 4) == 1342, "");
+	static_assert(vta::right_shift_tail<1>::transform(digits{}, 1, 2, 3, 4) == 1423, "");
+	static_assert(vta::shift_tail<-1>::transform(digits{}, 1, 2, 3, 4) == 1423, "");
+	static_assert(vta::drop<1>::transform(digits{}, 1, 2, 3) == 23, "");
+	static_assert(vta::drop<-1>::transform(digits{}, 1, 2, 3) == 3, "");
+	static_assert(vta::take<2>::transform(digits{}, 1, 2, 3) == 12, "");
+	static_assert(vta::take<-1>::transform(digits{}, 1, 2, 3) == 12, "");
+	static_assert(vta::slice<1, 2>::transform(digits{}, 1, 2, 3, 4) == 23, "");
+	static_assert(vta::slice<0, -1>::transform(digits{}, 1, 2, 3, 4) == 1234, "");
+	static_assert(vta::slice<3, -1>::transform(digits{}, 1, 2, 3, 4) == 4, "");
+	static_assert(vta::swap<0, -1>::transform(digits{}, 1, 2, 3) == 321, "");
+	static_assert(vta::cycle<0, 1, 2>::transform(digits{}, 1, 2, 3, 4) == 3124, "");
+	static_assert(vta::permute<2, 0, 1>::transform(digits{}, 1, 2, 3) == 312, "");
+	static_assert(vta::permute<2, 0, 1>::inverse::transform(digits{}, 3, 1, 2) == 123, "");
+	static_assert(vta::reverse::transform(digits{}, 1, 2, 3) == 321, "");
+	static_assert(vta::filter<std::is_integral>::transform(digits{}, 1, 2.0, 3) == 13, "");
+	static_assert(vta::sort_by<vta::greater_size>::transform(digits{}, char{1}, 2, short{3}) == 231, "");
+	static_assert(vta::compose<vta::flip, vta::reverse>::transform(digits{}, 1, 2, 3) == 312, "");
+	static_assert(vta::compose<vta::take<2>, vta::reverse>::transform(digits{}, 1, 2, 3, 4, 5) == 21, "");
+	static_assert(vta::compose<vta::take<3>, vta::left_shift<1>>::transform(digits{}, 1, 2, 3, 4, 5) == 231, "");
+	static_assert(vta::compose<vta::take<2>, vta::call_if<true>, vta::reverse>::transform(digits{}, 1, 2, 3, 4, 5) == 21, "");
+	static_assert(vta::compose<vta::drop<0>, vta::take<-1>, vta::right_shift<1>>::transform(digits{}, 1, 2, 3, 4) == 312, "");
+}
+
+BOOST_AUTO_TEST_CASE(numeric) {
+	static_assert(std::is_same<vta::numeric::accumulator_t<int, 2>, long long>::value, "");
+	static_assert(vta::numeric::sum(1, 2, 3) == 6, "");
+	static_assert(vta::numeric::mean(1, 2, 4) == 2, "");
+	static_assert(vta::numeric::min(3, 1, 2) == 1, "");
+	static_assert(vta::numeric::max(3, 1, 2) == 3, "");
+	static_assert(vta::numeric::minmax(3, 1, 2) == std::make_pair(1, 3), "");
+	static_assert(vta::numeric::argmin(3, 1, 2) == 1, "");
+	static_assert(vta::numeric::argmax(3, 1, 2) == 0, "");
+}
+
+BOOST_AUTO_TEST_CASE(reverse_polish_notation) {
+	static_assert(vta::rpn::compile(vta::rpn::arg<0>, 2, vta::rpn::multiply, 1, vta::rpn::add)(3) == 7, "");
+}
+
+BOOST_AUTO_TEST_CASE(bits) {
+	static_assert(vta::pack_bits(true, false, true) == 5, "");
+	static_assert(vta::unpack_bits<3>(5, digits{}) == 101, "");
+	static_assert(vta::mask_of(is_positive{})(1, -2, 3) == 5, "");
+}
+
+BOOST_AUTO_TEST_CASE(containers) {
+	constexpr vta::packed_tuple<char, double, int> t{'a', 1.5, 2};
+	static_assert(vta::get<0>(t) == 'a', "");
+	static_assert(vta::get<1>(t) == 1.5, "");
+	static_assert(vta::get<2>(vta::make_packed_tuple(1, 2, 3)) == 3, "");
+	static_assert(vta::apply(digits{}, vta::make_packed_tuple(1, 2, 3)) == 123, "");
+}
+
+BOOST_AUTO_TEST_CASE(type_map) {
+	static_assert(vta::type_id<int>() != vta::type_id<char>(), "");
+	static_assert(vta::type_map<int, char, int>::index_of<int>() == 1, "");
+	static_assert(vta::type_map<int, char, int>::find_index(vta::type_id<int>()) == 1, "");
+	static_assert(type_map_get() == 3, "");
+}
+
+BOOST_AUTO_TEST_CASE(macros) {
+	static_assert(restrict_sum(values, 4) == 10, "");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#include "vta/function_ref.hpp"
+#include "vta/functions.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+int subtract(int lhs, int rhs) {
+	return lhs - rhs;
+}
+
+struct counter {
+	int calls = 0;
+
+	int operator()(int x) {
+		++calls;
+		return x;
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(function_ref)
+
+BOOST_AUTO_TEST_CASE(calls_what_it_refers_to) {
+	int total = 0;
+	auto add = [&total](int x) { total += x; };
+	vta::function_ref<void(int)> f = add;
+	f(1);
+	f(2);
+	BOOST_CHECK_EQUAL(total, 3);
+
+	// The callable is referred to rather than copied, so its state is shared
+	counter c;
+	vta::function_ref<int(int)> g = c;
+	BOOST_CHECK_EQUAL(g(5), 5);
+	BOOST_CHECK_EQUAL(c.calls, 1);
+
+	// Functions and function pointers are stored by value
+	vta::function_ref<int(int, int)> h = subtract;
+	BOOST_CHECK_EQUAL(h(5, 3), 2);
+	h = &subtract;
+	BOOST_CHECK_EQUAL(h(3, 5), -2);
+
+	// Copies refer to the same callable
+	vta::function_ref<int(int)> copy = g;
+	copy(1);
+	BOOST_CHECK_EQUAL(c.calls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(converts_arguments_and_results) {
+	auto length = [](std::string const& s) { return s.size(); };
+	vta::function_ref<int(std::string const&)> f = length;
+	BOOST_CHECK_EQUAL(f("abc"), 3);
+
+	// Move-only arguments are forwarded without a copy
+	auto get = [](std::unique_ptr<int> p) { return *p; };
+	vta::function_ref<int(std::unique_ptr<int>)> g = get;
+	BOOST_CHECK_EQUAL(g(std::unique_ptr<int>{new int{4}}), 4);
+
+	// The result of the callable is discarded by a function_ref returning void
+	counter c;
+	vta::function_ref<void(int)> h = c;
+	h(1);
+	BOOST_CHECK_EQUAL(c.calls, 1);
+
+	static_assert(!std::is_constructible<vta::function_ref<int(int)>, decltype(length)>::value, "");
+	static_assert(!std::is_constructible<vta::function_ref<std::string(int, int)>, decltype(&subtract)>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(shares_adaptor_instantiations) {
+	int total = 0;
+	auto add = [&total](int x) { total += x; };
+	auto add_twice = [&total](int x) { total += 2 * x; };
+
+	typedef vta::function_ref<void(int)> ref;
+	static_assert(std::is_same<decltype(vta::map(ref{add})), decltype(vta::map(ref{add_twice}))>::value, "");
+
+	vta::map(ref{add})(1, 2, 3);
+	vta::map(ref{add_twice})(1, 2, 3);
+	BOOST_CHECK_EQUAL(total, 18);
+
+	auto max = [](int lhs, int rhs) { return lhs < rhs ? rhs : lhs; };
+	BOOST_CHECK_EQUAL(vta::foldl(vta::function_ref<int(int, int)>{max})(3, 9, 4), 9);
+	BOOST_CHECK_EQUAL(vta::foldl(vta::function_ref<int(int, int)>{subtract})(10, 1, 2), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
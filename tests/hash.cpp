@@ -0,0 +1,82 @@
+#include "vta/hash.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace {
+
+enum class colour : short {
+	red = -1,
+	green = 2
+};
+
+struct point {
+	int x;
+	int y;
+};
+
+}
+
+namespace vta {
+
+template <>
+struct is_contiguously_hashable<point> : std::true_type {
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(hash)
+
+BOOST_AUTO_TEST_CASE(equal_arguments_have_equal_hashes) {
+	static_assert(vta::hash(1, short(2), 'c', true, colour::red) == vta::hash(1, short(2), 'c', true, colour::red), "");
+	static_assert(vta::hash() == vta::hash(), "");
+
+	int x = 0;
+	BOOST_CHECK_EQUAL(vta::hash(&x, std::string("abc"), 2.5), vta::hash(&x, std::string("abc"), 2.5));
+	BOOST_CHECK_EQUAL(vta::hash(point{1, 2}, 3), vta::hash(point{1, 2}, 3));
+}
+
+BOOST_AUTO_TEST_CASE(different_arguments_have_different_hashes) {
+	static_assert(vta::hash(1, 2) != vta::hash(2, 1), "");
+	static_assert(vta::hash(1) != vta::hash(1, 0), "");
+	static_assert(vta::hash(colour::red) != vta::hash(colour::green), "");
+
+	// A negative value does not spill into its neighbour
+	static_assert(vta::hash(short(-1), short(0)) != vta::hash(short(-1), short(-1)), "");
+
+	// Arguments that straddle two words
+	static_assert(vta::hash(char(1), std::int64_t{2}) != vta::hash(char(1), std::int64_t{2} << 56), "");
+
+	BOOST_CHECK_NE(vta::hash(std::string("a"), 1), vta::hash(std::string("b"), 1));
+	BOOST_CHECK_NE(vta::hash(point{1, 2}), vta::hash(point{2, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(no_collisions_in_a_grid) {
+	std::set<std::uint64_t> hashes;
+	for(short x = -50; x < 50; ++x) {
+		for(unsigned char y = 0; y < 100; ++y) {
+			hashes.insert(vta::hash(x, y, std::int64_t{x} * y));
+		}
+	}
+	BOOST_CHECK_EQUAL(hashes.size(), 100u * 100u);
+}
+
+BOOST_AUTO_TEST_CASE(hash_after) {
+	static_assert(vta::hash_after<vta::reverse>(1, 'b', 3u) == vta::hash(3u, 'b', 1), "");
+	static_assert(vta::hash_after<vta::drop<1>>(1, 2, 3) == vta::hash(2, 3), "");
+	BOOST_CHECK_EQUAL(vta::hash_after<vta::reverse>(std::string("a"), 2), vta::hash(2, std::string("a")));
+}
+
+BOOST_AUTO_TEST_CASE(as_a_function_object) {
+	static_assert(vta::hash_f{}(1, 2) == vta::hash(1, 2), "");
+
+	// Hashes the elements of a tuple
+	std::tuple<int, std::string> const key{1, "a"};
+	BOOST_CHECK_EQUAL(vta::hash_f{}(vta::unpack(key)), vta::hash(1, std::string("a")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
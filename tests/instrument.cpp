@@ -0,0 +1,144 @@
+#include "vta/algorithms.hpp"
+#include "vta/instrument.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Built with VTA_INSTRUMENT and VTA_INSTRUMENT_CYCLES defined as 1, into the same executable as
+// instrument_plain.cpp, which is built without them
+
+// Defined in instrument_plain.cpp
+int plain_sum(int a, int b, int c);
+
+namespace {
+
+struct recorded {
+	std::string name;
+	int pack_size;
+	std::uint64_t cycles;
+};
+
+std::vector<recorded> probes;
+
+void record(vta::probe const& p) {
+	probes.push_back({p.name, p.pack_size, p.cycles});
+}
+
+// Records every probe sent during a test case
+struct recording {
+	vta::probe_sink previous;
+
+	recording()
+	: previous(vta::set_probe_sink(record)) {
+		probes.clear();
+	}
+
+	~recording() {
+		vta::set_probe_sink(previous);
+	}
+};
+
+struct plus {
+	int operator()(int lhs, int rhs) const {
+		return lhs + rhs;
+	}
+};
+
+struct is_positive {
+	bool operator()(int x) const {
+		return x > 0;
+	}
+};
+
+struct digits {
+	template <typename... Args>
+	int operator()(Args... args) const {
+		int const values[] = {0, args...};
+		int result = 0;
+		for(int value : values) {
+			result = result * 10 + value;
+		}
+		return result;
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(instrument)
+
+BOOST_FIXTURE_TEST_CASE(adaptors_report_each_call, recording) {
+	int total = 0;
+	vta::map([&total](int x) { total += x; })(1, 2, 3);
+	BOOST_CHECK_EQUAL(total, 6);
+	BOOST_CHECK_EQUAL(vta::foldl(plus{})(1, 2, 3, 4), 10);
+	BOOST_CHECK_EQUAL(vta::foldr(plus{})(1, 2, 3), 6);
+	BOOST_CHECK(vta::all_of(is_positive{})(1, 2));
+	BOOST_CHECK(vta::any_of(is_positive{})(-1, 2));
+	BOOST_CHECK(vta::none_of(is_positive{})(-1));
+
+	// The folds report once however many steps they take
+	std::vector<std::string> const names = {"vta::map", "vta::foldl", "vta::foldr", "vta::all_of",
+	                                        "vta::any_of", "vta::none_of"};
+	std::vector<int> const pack_sizes = {3, 4, 3, 2, 2, 1};
+	BOOST_REQUIRE_EQUAL(probes.size(), names.size());
+	for(std::size_t i = 0; i < probes.size(); ++i) {
+		BOOST_CHECK_EQUAL(probes[i].name, names[i]);
+		BOOST_CHECK_EQUAL(probes[i].pack_size, pack_sizes[i]);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(compose_reports_each_stage, recording) {
+	auto const f = vta::forward_after<vta::compose<vta::flip, vta::drop<1>, vta::reverse>>(digits{});
+	BOOST_CHECK_EQUAL(f(1, 2, 3, 4), 431);
+
+	// Each stage reports when it returns, so the innermost comes first
+	BOOST_REQUIRE_EQUAL(probes.size(), 4u);
+	BOOST_CHECK_EQUAL(probes[0].name, "vta::reverse");
+	BOOST_CHECK_EQUAL(probes[0].pack_size, 3);
+	BOOST_CHECK_EQUAL(probes[1].name, "vta::drop<1>");
+	BOOST_CHECK_EQUAL(probes[1].pack_size, 4);
+	BOOST_CHECK_EQUAL(probes[2].name, "vta::flip");
+	BOOST_CHECK_EQUAL(probes[2].pack_size, 4);
+	BOOST_CHECK_EQUAL(probes[3].pack_size, 4);
+
+	// The cycles of a stage include the stages nested inside it
+	for(std::size_t i = 1; i < probes.size(); ++i) {
+		BOOST_CHECK_GE(probes[i].cycles, probes[i - 1].cycles);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(instrument_reports_one_call_site, recording) {
+	auto const add = vta::instrument("add", plus{});
+	BOOST_CHECK_EQUAL(add(1, 2), 3);
+	vta::map(vta::instrument("positive", is_positive{}))(1, 2);
+
+	BOOST_REQUIRE_EQUAL(probes.size(), 4u);
+	BOOST_CHECK_EQUAL(probes[0].name, "add");
+	BOOST_CHECK_EQUAL(probes[0].pack_size, 2);
+	BOOST_CHECK_EQUAL(probes[1].name, "positive");
+	BOOST_CHECK_EQUAL(probes[2].name, "positive");
+	BOOST_CHECK_EQUAL(probes[2].pack_size, 1);
+	BOOST_CHECK_EQUAL(probes[3].name, "vta::map");
+}
+
+BOOST_FIXTURE_TEST_CASE(plain_adaptors_can_share_a_program, recording) {
+	// The same specialization of foldl, instrumented here and plain in instrument_plain.cpp
+	BOOST_CHECK_EQUAL(vta::foldl(std::plus<int>{})(1, 2, 3), 6);
+	BOOST_CHECK_EQUAL(plain_sum(1, 2, 3), 6);
+	BOOST_REQUIRE_EQUAL(probes.size(), 1u);
+	BOOST_CHECK_EQUAL(probes[0].name, "vta::foldl");
+}
+
+BOOST_AUTO_TEST_CASE(no_sink_discards_probes) {
+	probes.clear();
+	vta::probe_sink const previous = vta::set_probe_sink(nullptr);
+	BOOST_CHECK_EQUAL(vta::foldl(plus{})(1, 2), 3);
+	BOOST_CHECK(vta::set_probe_sink(previous) == nullptr);
+	BOOST_CHECK(probes.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,53 @@
+# Fails if the adaptors built with VTA_INSTRUMENT as 0 leave any probe behind, or more code than the
+# same functions written by hand. The build with VTA_INSTRUMENT as 1 must contain the probes, so that
+# a check that finds nothing is known to be looking in the right place.
+#
+# cmake -DNM=<nm> -DSIZE=<size> -DDISABLED=<object> -DENABLED=<object> -DHAND_WRITTEN=<object>
+#       -P instrument_codegen.cmake
+
+# Sets <prefix>_PROBES to the number of symbols that mention probe and <prefix>_TEXT to the size of
+# the .text sections of the file
+function(measure file prefix)
+	execute_process(COMMAND ${NM} -P -C ${file} OUTPUT_VARIABLE symbols RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${NM} failed on ${file}")
+	endif()
+	string(REPLACE ";" "," symbols "${symbols}")
+	string(REPLACE "\n" ";" symbols "${symbols}")
+	set(probes 0)
+	foreach(line ${symbols})
+		if(line MATCHES "probe")
+			math(EXPR probes "${probes} + 1")
+		endif()
+	endforeach()
+
+	execute_process(COMMAND ${SIZE} -A ${file} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${SIZE} failed on ${file}")
+	endif()
+	string(REPLACE "\n" ";" sections "${sections}")
+	set(text 0)
+	foreach(line ${sections})
+		if(line MATCHES "^\\.text[^ ]* +([0-9]+)")
+			math(EXPR text "${text} + ${CMAKE_MATCH_1}")
+		endif()
+	endforeach()
+
+	set(${prefix}_PROBES ${probes} PARENT_SCOPE)
+	set(${prefix}_TEXT ${text} PARENT_SCOPE)
+endfunction()
+
+foreach(variant DISABLED ENABLED HAND_WRITTEN)
+	measure(${${variant}} ${variant})
+	message("${variant}: ${${variant}_PROBES} probe symbols, ${${variant}_TEXT} bytes of .text")
+endforeach()
+
+if(ENABLED_PROBES EQUAL 0)
+	message(FATAL_ERROR "The instrumented build has no probe symbols, so their absence proves nothing")
+endif()
+if(NOT DISABLED_PROBES EQUAL 0)
+	message(FATAL_ERROR "The build without VTA_INSTRUMENT still has ${DISABLED_PROBES} probe symbols")
+endif()
+if(DISABLED_TEXT GREATER HAND_WRITTEN_TEXT)
+	message(FATAL_ERROR "The build without VTA_INSTRUMENT has ${DISABLED_TEXT} bytes of .text, more than the ${HAND_WRITTEN_TEXT} bytes written by hand")
+endif()
@@ -0,0 +1,77 @@
+#include "vta/algorithms.hpp"
+
+// Compiled at -O2 three times: with VTA_INSTRUMENT as 0 and as 1, and with HAND_WRITTEN defined to
+// spell out the same functions without VTA. instrument_codegen.cmake checks that the probes leave
+// nothing behind when they are disabled.
+
+namespace {
+
+struct plus {
+	int operator()(int lhs, int rhs) const {
+		return lhs + rhs;
+	}
+};
+
+struct is_positive {
+	bool operator()(int x) const {
+		return x > 0;
+	}
+};
+
+struct weigh {
+	int operator()(int a, int b, int c) const {
+		return a * 100 + b * 10 + c;
+	}
+};
+
+}
+
+extern int total;
+
+#ifndef HAND_WRITTEN
+
+void codegen_map(int a, int b, int c) {
+	vta::map([](int x) { total += x; })(a, b, c);
+}
+
+int codegen_foldl(int a, int b, int c, int d) {
+	return vta::foldl(plus{})(a, b, c, d);
+}
+
+int codegen_foldr(int a, int b, int c, int d) {
+	return vta::foldr(plus{})(a, b, c, d);
+}
+
+bool codegen_all_of(int a, int b, int c) {
+	return vta::all_of(is_positive{})(a, b, c);
+}
+
+int codegen_compose(int a, int b, int c, int d) {
+	return vta::forward_after<vta::compose<vta::flip, vta::drop<1>, vta::reverse>>(weigh{})(a, b, c, d);
+}
+
+#else
+
+void codegen_map(int a, int b, int c) {
+	total += a;
+	total += b;
+	total += c;
+}
+
+int codegen_foldl(int a, int b, int c, int d) {
+	return plus{}(plus{}(plus{}(a, b), c), d);
+}
+
+int codegen_foldr(int a, int b, int c, int d) {
+	return plus{}(a, plus{}(b, plus{}(c, d)));
+}
+
+bool codegen_all_of(int a, int b, int c) {
+	return is_positive{}(a) && is_positive{}(b) && is_positive{}(c);
+}
+
+int codegen_compose(int a, int, int c, int d) {
+	return weigh{}(d, c, a);
+}
+
+#endif
@@ -0,0 +1,10 @@
+#include "vta/algorithms.hpp"
+
+#include <functional>
+
+// Built without VTA_INSTRUMENT, into the same executable as instrument.cpp, which uses the same
+// specialization of foldl with it
+
+int plain_sum(int a, int b, int c) {
+	return vta::foldl(std::plus<int>{})(a, b, c);
+}
@@ -0,0 +1,145 @@
+#include "vta/memoize.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct counted_square {
+	std::shared_ptr<std::atomic<int>> calls;
+
+	int operator()(int x) const {
+		++*calls;
+		return x * x;
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(memoize)
+
+BOOST_AUTO_TEST_CASE(calls_once_per_arguments) {
+	auto const calls = std::make_shared<std::atomic<int>>(0);
+	auto const square = vta::memoize(counted_square{calls});
+	BOOST_CHECK_EQUAL(*square(3), 9);
+	BOOST_CHECK_EQUAL(*square(3), 9);
+	BOOST_CHECK_EQUAL(*square(4), 16);
+	BOOST_CHECK_EQUAL(calls->load(), 2);
+
+	// Copies share the cache
+	auto const copy = square;
+	BOOST_CHECK_EQUAL(*copy(4), 16);
+	BOOST_CHECK_EQUAL(calls->load(), 2);
+
+	vta::memoize_statistics const stats = square.statistics();
+	BOOST_CHECK_EQUAL(stats.hits, 2u);
+	BOOST_CHECK_EQUAL(stats.misses, 2u);
+	BOOST_CHECK_EQUAL(stats.evictions, 0u);
+	BOOST_CHECK_CLOSE(stats.hit_rate(), 0.5, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(heterogeneous_arguments) {
+	int calls = 0;
+	auto const describe = vta::memoize([&calls](auto const&... args) {
+		++calls;
+		return std::to_string(sizeof...(args));
+	});
+	BOOST_CHECK_EQUAL(*describe(1, std::string("a")), "2");
+	BOOST_CHECK_EQUAL(*describe(1, std::string("a")), "2");
+	BOOST_CHECK_EQUAL(*describe(std::string("a"), 1), "2");
+	BOOST_CHECK_EQUAL(*describe(1, std::string("b")), "2");
+	BOOST_CHECK_EQUAL(*describe(), "0");
+	BOOST_CHECK_EQUAL(*describe(), "0");
+
+	// A pointer to a string is keyed on its address, not on the characters it points to
+	char const* const literal = "a";
+	BOOST_CHECK_EQUAL(*describe(literal), "1");
+	BOOST_CHECK_EQUAL(*describe(literal), "1");
+
+	// 1 and 1L have equal values but are different keys, and the type of the key is part of the hash
+	BOOST_CHECK_EQUAL(*describe(1L, std::string("a")), "2");
+	BOOST_CHECK_EQUAL(calls, 6);
+}
+
+BOOST_AUTO_TEST_CASE(move_only_results) {
+	auto const make = vta::memoize([](int x) { return std::unique_ptr<int>(new int(x)); });
+	std::shared_ptr<std::unique_ptr<int> const> const first = make(7);
+	std::shared_ptr<std::unique_ptr<int> const> const second = make(7);
+	BOOST_CHECK_EQUAL(**first, 7);
+	BOOST_CHECK(first == second);
+}
+
+BOOST_AUTO_TEST_CASE(bounded_capacity) {
+	auto const calls = std::make_shared<std::atomic<int>>(0);
+	auto const square = vta::memoize(counted_square{calls}, 32);
+	for(int i = 0; i < 1000; ++i) {
+		BOOST_CHECK_EQUAL(*square(i), i * i);
+	}
+	vta::memoize_statistics const stats = square.statistics();
+	BOOST_CHECK_EQUAL(stats.misses, 1000u);
+	BOOST_CHECK_GE(stats.evictions, 1000u - 32u);
+
+	// Results stay valid after they are evicted
+	std::shared_ptr<int const> const kept = square(-1);
+	for(int i = 0; i < 1000; ++i) {
+		square(i);
+	}
+	BOOST_CHECK_EQUAL(*kept, 1);
+}
+
+BOOST_AUTO_TEST_CASE(exact_capacity) {
+	// Small capacities are not rounded up to one entry per shard
+	for(std::size_t capacity : {0u, 1u, 3u, 17u, 100u}) {
+		auto const calls = std::make_shared<std::atomic<int>>(0);
+		auto const square = vta::memoize(counted_square{calls}, capacity);
+		for(int i = 0; i < 1000; ++i) {
+			square(i);
+		}
+		BOOST_CHECK_GE(square.statistics().evictions, 1000u - std::max<std::size_t>(capacity, 1));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(clock_keeps_used_entries) {
+	auto const calls = std::make_shared<std::atomic<int>>(0);
+	auto const square = vta::memoize(counted_square{calls}, 16 * 4);
+
+	// A key that is hit between misses is given a second chance each time the hand passes it
+	for(int i = 0; i < 1000; ++i) {
+		square(0);
+		square(i + 1);
+	}
+	BOOST_CHECK_EQUAL(square.statistics().hits, 999u);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_calls) {
+	auto const calls = std::make_shared<std::atomic<int>>(0);
+	auto const square = vta::memoize(counted_square{calls}, 256);
+	std::vector<std::thread> threads;
+	std::atomic<int> wrong{0};
+	for(int t = 0; t < 4; ++t) {
+		threads.emplace_back([&square, &wrong] {
+			for(int i = 0; i < 10000; ++i) {
+				int const x = i % 100;
+				if(*square(x) != x * x) {
+					++wrong;
+				}
+			}
+		});
+	}
+	for(std::thread& thread : threads) {
+		thread.join();
+	}
+	BOOST_CHECK_EQUAL(wrong.load(), 0);
+	vta::memoize_statistics const stats = square.statistics();
+	BOOST_CHECK_EQUAL(stats.hits + stats.misses, 40000u);
+	BOOST_CHECK_LE(calls->load(), 400);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
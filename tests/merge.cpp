@@ -0,0 +1,148 @@
+#include "vta/merge.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Orders pairs by their first element only, to check that equal elements keep the order of the
+// ranges they came from
+struct first_less {
+	bool operator()(std::pair<int, char> const& lhs, std::pair<int, char> const& rhs) const {
+		return lhs.first < rhs.first;
+	}
+};
+
+template <std::size_t... Is>
+std::vector<int> merge_runs(std::vector<std::vector<int>> const& runs, std::index_sequence<Is...>) {
+	std::vector<int> out;
+	vta::merge(std::back_inserter(out), runs[Is]...);
+	return out;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(merge)
+
+BOOST_AUTO_TEST_CASE(merges_sorted_ranges) {
+	std::vector<int> const a = {1, 4, 7};
+	std::vector<int> const b = {2, 5, 8};
+	std::vector<int> const c = {0, 3, 6, 9};
+	std::vector<int> out(10);
+	BOOST_CHECK(vta::merge(out.begin(), a, b, c) == out.end());
+	BOOST_CHECK((out == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+	std::vector<int> single;
+	vta::merge(std::back_inserter(single), a);
+	BOOST_CHECK(single == a);
+
+	int none[1] = {-1};
+	BOOST_CHECK(vta::merge(none) == none);
+	BOOST_CHECK_EQUAL(none[0], -1);
+}
+
+BOOST_AUTO_TEST_CASE(every_number_of_ranges) {
+	std::vector<std::vector<int>> runs;
+	for(int k = 0; k < 16; ++k) {
+		std::vector<int> run;
+		for(int i = 0; i < k % 5; ++i) {
+			run.push_back((i * 7 + k * 3) % 11);
+		}
+		std::sort(run.begin(), run.end());
+		runs.push_back(run);
+	}
+
+	std::vector<int> expected;
+	for(auto const& run : runs) {
+		expected.insert(expected.end(), run.begin(), run.end());
+	}
+	std::sort(expected.begin(), expected.end());
+	BOOST_CHECK(merge_runs(runs, std::make_index_sequence<16>{}) == expected);
+
+	runs.resize(5);
+	expected.clear();
+	for(auto const& run : runs) {
+		expected.insert(expected.end(), run.begin(), run.end());
+	}
+	std::sort(expected.begin(), expected.end());
+	BOOST_CHECK(merge_runs(runs, std::make_index_sequence<5>{}) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(empty_ranges) {
+	std::vector<int> const empty;
+	std::vector<int> const a = {1, 3};
+	std::vector<int> out;
+	vta::merge(std::back_inserter(out), empty, a, empty, empty);
+	BOOST_CHECK(out == a);
+
+	out.clear();
+	vta::merge(std::back_inserter(out), empty, empty);
+	BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(different_kinds_of_range) {
+	std::list<int> const a = {2, 6};
+	int const b[] = {1, 5, 9};
+	std::array<int, 2> const c = {{3, 4}};
+	std::vector<int> out;
+	vta::merge(std::back_inserter(out), a, b, c);
+	BOOST_CHECK((out == std::vector<int>{1, 2, 3, 4, 5, 6, 9}));
+}
+
+BOOST_AUTO_TEST_CASE(custom_comparison) {
+	std::vector<int> const a = {9, 4, 1};
+	std::vector<int> const b = {8, 3, 2};
+	std::vector<int> out;
+	vta::merge_by(std::greater<int>{}, std::back_inserter(out), a, b);
+	BOOST_CHECK((out == std::vector<int>{9, 8, 4, 3, 2, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(stable) {
+	std::vector<std::pair<int, char>> const a = {{1, 'a'}, {2, 'a'}};
+	std::vector<std::pair<int, char>> const b = {{1, 'b'}, {2, 'b'}};
+	std::vector<std::pair<int, char>> const c = {{1, 'c'}, {3, 'c'}};
+	std::vector<std::pair<int, char>> out;
+	vta::merge_by(first_less{}, std::back_inserter(out), a, b, c);
+	std::string order;
+	for(auto const& p : out) {
+		order += p.second;
+	}
+	BOOST_CHECK_EQUAL(order, "abcabc");
+}
+
+BOOST_AUTO_TEST_CASE(moves_from_rvalue_ranges) {
+	std::vector<std::unique_ptr<int>> a;
+	a.push_back(std::make_unique<int>(1));
+	a.push_back(std::make_unique<int>(3));
+	std::vector<std::unique_ptr<int>> b;
+	b.push_back(std::make_unique<int>(2));
+
+	std::vector<std::unique_ptr<int>> out;
+	vta::merge_by([](std::unique_ptr<int> const& lhs, std::unique_ptr<int> const& rhs){ return *lhs < *rhs; },
+	              std::back_inserter(out), std::move(a), std::move(b));
+	BOOST_REQUIRE_EQUAL(out.size(), 3u);
+	BOOST_CHECK_EQUAL(*out[0], 1);
+	BOOST_CHECK_EQUAL(*out[1], 2);
+	BOOST_CHECK_EQUAL(*out[2], 3);
+	BOOST_CHECK(a[0] == nullptr);
+	BOOST_CHECK(b[0] == nullptr);
+
+	// Only the rvalue range is moved from
+	std::vector<std::string> const kept = {"a", "c"};
+	std::vector<std::string> moved = {"b"};
+	std::vector<std::string> strings;
+	vta::merge(std::back_inserter(strings), kept, std::move(moved));
+	BOOST_CHECK((strings == std::vector<std::string>{"a", "b", "c"}));
+	BOOST_CHECK_EQUAL(kept[0], "a");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,24 @@
+// Built only with VTA_BUILD_MODULE, as a check that the named module exports the same API as the
+// header. It does not use Boost.Test, whose headers would have to be imported alongside it.
+
+import vta;
+
+namespace {
+
+struct plus {
+	template <typename LHS, typename RHS>
+	constexpr auto operator()(LHS lhs, RHS rhs) const {
+		return lhs + rhs;
+	}
+};
+
+} // namespace
+
+static_assert(vta::foldl(plus{})(1, 2, 3, 4, 5) == 15, "");
+static_assert(vta::at<-1>(1, 2, 3) == 3, "");
+
+int main() {
+	int sum = 0;
+	vta::map([&sum](int i) { sum += i; })(1, 2, 3);
+	return sum == 6 ? 0 : 1;
+}
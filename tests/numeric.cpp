@@ -0,0 +1,81 @@
+#include "vta/numeric.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+int const int_max = std::numeric_limits<int>::max();
+int const int_min = std::numeric_limits<int>::min();
+long long const llong_max = std::numeric_limits<long long>::max();
+long long const llong_min = std::numeric_limits<long long>::min();
+unsigned long long const ullong_max = std::numeric_limits<unsigned long long>::max();
+double const double_max = std::numeric_limits<double>::max();
+
+}
+
+BOOST_AUTO_TEST_SUITE(numeric)
+
+BOOST_AUTO_TEST_CASE(sum) {
+	static_assert(vta::numeric::sum(1) == 1, "");
+	static_assert(vta::numeric::sum(1, 2, 3) == 6, "");
+	static_assert(vta::numeric::sum(int_max, int_max) == 2ll * int_max, "");
+	static_assert(std::is_same<decltype(vta::numeric::sum(1, 2)), long long>::value, "");
+	static_assert(std::is_same<decltype(vta::numeric::sum(1.0f, 2.0f)), double>::value, "");
+	BOOST_CHECK_EQUAL(vta::numeric::sum(0.5, 0.25), 0.75);
+}
+
+BOOST_AUTO_TEST_CASE(mean) {
+	static_assert(vta::numeric::mean(1) == 1, "");
+	static_assert(vta::numeric::mean(1, 2) == 1, "");
+	static_assert(vta::numeric::mean(-7, -8) == -7, "");
+	static_assert(vta::numeric::mean(-1, 15, 2, -3, 0, 0, 2, 3) == 2, "");
+	static_assert(vta::numeric::mean(int_max, int_max - 2) == int_max - 1, "");
+	static_assert(vta::numeric::mean(int_min, int_min + 2) == int_min + 1, "");
+	static_assert(vta::numeric::mean(1u, 2u, 4u) == 2u, "");
+	static_assert(vta::numeric::mean(llong_max, llong_max - 2, llong_max - 4) == llong_max - 2, "");
+	static_assert(std::is_same<decltype(vta::numeric::mean(1, 2)), int>::value, "");
+
+	// 64-bit integers are not divided in a 128-bit type
+	static_assert(vta::numeric::mean(llong_min, llong_min + 2, llong_min + 4) == llong_min + 2, "");
+	static_assert(vta::numeric::mean(-llong_max, llong_max, -1ll) == 0, "");
+	static_assert(vta::numeric::mean(ullong_max, ullong_max - 1) == ullong_max - 1, "");
+	for(long long a = -10; a <= 10; ++a) {
+		for(long long b = -10; b <= 10; ++b) {
+			BOOST_CHECK_EQUAL(vta::numeric::mean(llong_max - 20 + a, b), (llong_max - 20 + a + b) / 2);
+		}
+	}
+	BOOST_CHECK_EQUAL(vta::numeric::mean(1.0, 2.0), 1.5);
+	BOOST_CHECK_EQUAL(vta::numeric::mean(double_max, double_max), double_max);
+}
+
+BOOST_AUTO_TEST_CASE(exact_mean) {
+	using vta::numeric::detail::mean;
+	std::false_type const no_wider{};
+	std::true_type const integral{};
+	static_assert(mean<long long, 3>(no_wider, integral, llong_max, llong_max - 2, llong_max - 4) == llong_max - 2, "");
+	for(int a = -10; a <= 10; ++a) {
+		for(int b = -10; b <= 10; ++b) {
+			for(int c = -10; c <= 10; ++c) {
+				BOOST_CHECK_EQUAL((mean<int, 3>(no_wider, integral, a, b, c)), (a + b + c) / 3);
+			}
+		}
+	}
+	static_assert(mean<double, 2>(no_wider, std::false_type{}, 1.0, 2.0) == 1.5, "");
+}
+
+BOOST_AUTO_TEST_CASE(min_max) {
+	static_assert(vta::numeric::min(3) == 3, "");
+	static_assert(vta::numeric::min(3, 1, 2) == 1, "");
+	static_assert(vta::numeric::max(3, 1, 2) == 3, "");
+	static_assert(vta::numeric::minmax(3, 1, 2) == std::make_pair(1, 3), "");
+	static_assert(vta::numeric::argmin(3, 1, 2, 1) == 1, "");
+	static_assert(vta::numeric::argmax(3, 1, 5, 5) == 2, "");
+	static_assert(vta::numeric::argmax(3) == 0, "");
+	BOOST_CHECK_EQUAL(vta::numeric::max(0.5, -1.0), 0.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
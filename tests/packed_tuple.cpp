@@ -0,0 +1,85 @@
+#include "vta/access.hpp"
+#include "vta/functions.hpp"
+#include "vta/packed_tuple.hpp"
+
+#include "printer.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+struct empty {};
+
+}
+
+BOOST_AUTO_TEST_SUITE(packed_tuple)
+
+BOOST_AUTO_TEST_CASE(layout) {
+	static_assert(sizeof(vta::packed_tuple<char, double, char, int>) == 2 * sizeof(double), "");
+	static_assert(sizeof(vta::packed_tuple<char, double, char, int>)
+	           <= sizeof(std::tuple<char, double, char, int>), "");
+	static_assert(sizeof(vta::packed_tuple<empty, int>) == sizeof(int), "");
+	static_assert(sizeof(vta::packed_tuple<int, empty>) == sizeof(int), "");
+	static_assert(std::is_empty<vta::packed_tuple<empty>>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE(get) {
+	vta::packed_tuple<char, double, char, int> t{'1', 2.5, '3', 4};
+	BOOST_CHECK_EQUAL(vta::get<0>(t), '1');
+	BOOST_CHECK_EQUAL(vta::get<1>(t), 2.5);
+	BOOST_CHECK_EQUAL(vta::get<2>(t), '3');
+	BOOST_CHECK_EQUAL(vta::get<3>(t), 4);
+
+	vta::get<3>(t) = 5;
+	BOOST_CHECK_EQUAL(vta::get<3>(t), 5);
+
+	vta::packed_tuple<std::string, char> s{"hello", '!'};
+	std::string const moved = vta::get<0>(std::move(s));
+	BOOST_CHECK_EQUAL(moved, "hello");
+
+	constexpr vta::packed_tuple<int, char> c{1, '2'};
+	static_assert(vta::get<0>(c) == 1, "");
+	static_assert(vta::get<1>(c) == '2', "");
+}
+
+BOOST_AUTO_TEST_CASE(copy) {
+	vta::packed_tuple<int> const t{1};
+	vta::packed_tuple<int> u{t};
+	BOOST_CHECK_EQUAL(vta::get<0>(u), 1);
+
+	auto v = vta::make_packed_tuple(std::string{"2"}, 3.5);
+	static_assert(std::is_same<decltype(v), vta::packed_tuple<std::string, double>>::value, "");
+	auto w = std::move(v);
+	BOOST_CHECK_EQUAL(vta::get<0>(w), "2");
+	BOOST_CHECK_EQUAL(vta::get<1>(w), 3.5);
+}
+
+BOOST_AUTO_TEST_CASE(apply) {
+	vta::packed_tuple<char, double, char, int> const t{'1', 2.5, '3', 4};
+
+	{
+		std::stringstream ss;
+		vta::apply(vta::map(printer{ss}), t);
+		BOOST_CHECK_EQUAL(ss.str(), "12.534");
+	}
+
+	{
+		std::stringstream ss;
+		vta::apply(vta::forward_after<vta::reverse>(vta::map(printer{ss})), t);
+		BOOST_CHECK_EQUAL(ss.str(), "432.51");
+	}
+
+	{
+		vta::packed_tuple<int, double> u{1, 2.0};
+		vta::apply(vta::map([](auto& x){ x *= 2; }), u);
+		BOOST_CHECK_EQUAL(vta::get<0>(u), 2);
+		BOOST_CHECK_EQUAL(vta::get<1>(u), 4.0);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,21 @@
+#ifndef INCLUDE_GUARD_6EAC9EC2_CFD0_4342_B66F_AE1545BFBF2F
+#define INCLUDE_GUARD_6EAC9EC2_CFD0_4342_B66F_AE1545BFBF2F
+
+// A function object, shared by the tests, that writes each argument it is called with to a stream
+
+#include <ostream>
+
+struct printer {
+	printer(std::ostream& str)
+	: m_str{&str} {
+	}
+
+	template <typename T>
+	void operator()(T const& obj) {
+		*m_str << obj;
+	}
+
+	std::ostream* m_str;
+};
+
+#endif
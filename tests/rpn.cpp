@@ -0,0 +1,44 @@
+#include "vta/rpn.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <type_traits>
+
+namespace {
+
+struct square_t {
+	static int const arity = 1;
+
+	template <typename T>
+	constexpr static T apply(T t) {
+		return t * t;
+	}
+};
+
+constexpr square_t square{};
+
+}
+
+BOOST_AUTO_TEST_SUITE(rpn)
+
+BOOST_AUTO_TEST_CASE(constants) {
+	static_assert(vta::rpn::compile(1)() == 1, "");
+	static_assert(vta::rpn::compile(2, 3, vta::rpn::add)() == 5, "");
+	static_assert(vta::rpn::compile(5, 2, vta::rpn::subtract, 7, vta::rpn::multiply)() == 21, "");
+	static_assert(vta::rpn::compile(15, 4, vta::rpn::divide, 1, vta::rpn::add)() == 4, "");
+	static_assert(vta::rpn::compile(1, 2, 3, 4, 5, vta::rpn::add, vta::rpn::add, vta::rpn::add, vta::rpn::add, vta::rpn::negate)() == -15, "");
+	BOOST_CHECK_EQUAL(vta::rpn::compile(1.5, 2, vta::rpn::multiply)(), 3.0);
+}
+
+BOOST_AUTO_TEST_CASE(placeholders) {
+	constexpr auto e = vta::rpn::compile(vta::rpn::arg<0>, vta::rpn::arg<1>, vta::rpn::subtract, 2, vta::rpn::multiply);
+	static_assert(e(5, 2) == 6, "");
+	BOOST_CHECK_EQUAL(e(2, 5), -6);
+	BOOST_CHECK_EQUAL(e(2.5, 1), 3.0);
+
+	constexpr auto f = vta::rpn::compile(vta::rpn::arg<1>, square, vta::rpn::arg<0>, vta::rpn::divide);
+	static_assert(f(2, 4) == 8, "");
+	static_assert(std::is_same<decltype(f(2.0, 4)), double>::value, "");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
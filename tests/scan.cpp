@@ -0,0 +1,92 @@
+#include "vta/scan.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+struct plus {
+	template <typename T, typename U>
+	constexpr auto operator()(T lhs, U rhs) const {
+		return lhs + rhs;
+	}
+};
+
+struct minus {
+	template <typename T, typename U>
+	constexpr auto operator()(T lhs, U rhs) const {
+		return lhs - rhs;
+	}
+};
+
+// Counts how many times it is called, to check that each argument is folded in exactly once
+struct counting_plus {
+	int* calls;
+
+	int operator()(int lhs, int rhs) const {
+		++*calls;
+		return lhs + rhs;
+	}
+};
+
+constexpr std::array<int, 4> offsets = vta::scanl(plus{})(0, 4, 2, 8);
+
+}
+
+BOOST_AUTO_TEST_SUITE(scan)
+
+BOOST_AUTO_TEST_CASE(scanl) {
+	static_assert(std::get<0>(offsets) == 0, "");
+	static_assert(std::get<1>(offsets) == 4, "");
+	static_assert(std::get<2>(offsets) == 6, "");
+	static_assert(std::get<3>(offsets) == 14, "");
+	static_assert(std::get<0>(vta::scanl(plus{})(1)) == 1, "");
+	static_assert(std::get<2>(vta::scanl(minus{})(10, 1, 2)) == 7, "");
+
+	auto const strings = vta::scanl(plus{})(std::string{"a"}, 'b', "c");
+	BOOST_CHECK((strings == std::array<std::string, 3>{{"a", "ab", "abc"}}));
+
+	int calls = 0;
+	auto const sums = vta::scanl(counting_plus{&calls})(0, 1, 2, 3, 4);
+	BOOST_CHECK((sums == std::array<int, 5>{{0, 1, 3, 6, 10}}));
+	BOOST_CHECK_EQUAL(calls, 4);
+}
+
+BOOST_AUTO_TEST_CASE(scanr) {
+	constexpr auto results = vta::scanr(minus{})(1, 2, 10);
+	static_assert(std::get<0>(results) == 9, "");
+	static_assert(std::get<1>(results) == -8, "");
+	static_assert(std::get<2>(results) == 10, "");
+	static_assert(std::get<0>(vta::scanr(minus{})(1)) == 1, "");
+
+	auto const strings = vta::scanr(plus{})('a', "b", std::string{"c"});
+	BOOST_CHECK((strings == std::array<std::string, 3>{{"abc", "bc", "c"}}));
+
+	int calls = 0;
+	auto const sums = vta::scanr(counting_plus{&calls})(1, 2, 3, 4, 0);
+	BOOST_CHECK((sums == std::array<int, 5>{{10, 9, 7, 4, 0}}));
+	BOOST_CHECK_EQUAL(calls, 4);
+}
+
+BOOST_AUTO_TEST_CASE(result_types) {
+	static_assert(std::is_same<decltype(vta::scanl(plus{})(0, 1, 2)), std::array<int, 3>>::value, "");
+	static_assert(std::is_same<decltype(vta::scanl(plus{})(0, 1.5, 2)), std::tuple<int, double, double>>::value, "");
+	static_assert(std::is_same<decltype(vta::scanr(plus{})(1.5, 2, 0)), std::tuple<double, int, int>>::value, "");
+	static_assert(std::is_same<decltype(vta::scanl(plus{})('a', 1)), std::tuple<char, int>>::value, "");
+
+	constexpr auto mixed = vta::scanl(plus{})(0, 1.5, 2);
+	static_assert(std::get<0>(mixed) == 0, "");
+	static_assert(std::get<1>(mixed) == 1.5, "");
+	static_assert(std::get<2>(mixed) == 3.5, "");
+
+	// Results are moved into place, so move-only results work
+	auto const pointers = vta::scanl([](std::unique_ptr<int> const& p, int x){ return std::make_unique<int>(*p + x); })(std::make_unique<int>(1), 2);
+	BOOST_CHECK_EQUAL(*std::get<1>(pointers), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
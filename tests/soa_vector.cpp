@@ -0,0 +1,155 @@
+#include "vta/soa_vector.hpp"
+
+#include "printer.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+struct counted {
+	static int alive;
+
+	counted(int i)
+	: value{i} {
+		if(i < 0) {
+			throw std::runtime_error{"negative"};
+		}
+		++alive;
+	}
+
+	counted(counted const& other)
+	: value{other.value} {
+		++alive;
+	}
+
+	~counted() {
+		--alive;
+	}
+
+	int value;
+};
+
+int counted::alive = 0;
+
+// Copying throws once copies_left reaches zero, and moving copies
+struct fragile {
+	static int copies_left;
+
+	fragile(int i)
+	: value{i} {
+	}
+
+	fragile(fragile const& other)
+	: value{other.value} {
+		if(copies_left-- == 0) {
+			throw std::runtime_error{"copy"};
+		}
+	}
+
+	int value;
+};
+
+int fragile::copies_left = 0;
+
+template <typename T>
+bool is_aligned(T const* p) {
+	return reinterpret_cast<std::uintptr_t>(p) % vta::soa_vector<char>::column_alignment == 0;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(soa_vector)
+
+BOOST_AUTO_TEST_CASE(push_back) {
+	vta::soa_vector<char, double, std::string> v;
+	BOOST_CHECK(v.empty());
+
+	for(int i = 0; i < 100; ++i) {
+		v.push_back('a' + i % 26, i * 0.5, std::to_string(i));
+	}
+
+	BOOST_CHECK_EQUAL(v.size(), 100u);
+	BOOST_CHECK_GE(v.capacity(), 100u);
+	BOOST_CHECK_EQUAL(v.column<0>()[27], 'b');
+	BOOST_CHECK_EQUAL(v.column<1>()[27], 13.5);
+	BOOST_CHECK_EQUAL(v.column<2>()[27], "27");
+	BOOST_CHECK(is_aligned(v.column<0>()));
+	BOOST_CHECK(is_aligned(v.column<1>()));
+	BOOST_CHECK(is_aligned(v.column<2>()));
+
+	v.pop_back();
+	BOOST_CHECK_EQUAL(v.size(), 99u);
+	v.clear();
+	BOOST_CHECK(v.empty());
+}
+
+BOOST_AUTO_TEST_CASE(row) {
+	vta::soa_vector<int, char, double> v;
+	v.push_back(1, '2', 3.5);
+	v.push_back(4, '5', 6.5);
+
+	{
+		std::stringstream ss;
+		vta::apply(vta::forward_after<vta::reverse>(vta::map(printer{ss})), v.row(1));
+		BOOST_CHECK_EQUAL(ss.str(), "6.554");
+	}
+
+	std::get<0>(v.row(0)) = 7;
+	BOOST_CHECK_EQUAL(v.column<0>()[0], 7);
+}
+
+BOOST_AUTO_TEST_CASE(copy_and_move) {
+	vta::soa_vector<std::string, int> v;
+	v.push_back("one", 1);
+	v.push_back("two", 2);
+
+	auto const copy = v;
+	BOOST_CHECK_EQUAL(copy.size(), 2u);
+	BOOST_CHECK_EQUAL(copy.column<0>()[1], "two");
+
+	auto const moved = std::move(v);
+	BOOST_CHECK_EQUAL(moved.size(), 2u);
+	BOOST_CHECK_EQUAL(v.size(), 0u);
+
+	vta::soa_vector<std::unique_ptr<int>> u;
+	for(int i = 0; i < 20; ++i) {
+		u.push_back(std::make_unique<int>(i));
+	}
+	BOOST_CHECK_EQUAL(*u.column<0>()[19], 19);
+}
+
+BOOST_AUTO_TEST_CASE(exception_safety) {
+	{
+		vta::soa_vector<counted, counted> v;
+		v.push_back(1, 2);
+		BOOST_CHECK_THROW(v.push_back(3, -4), std::runtime_error);
+		BOOST_CHECK_EQUAL(v.size(), 1u);
+		BOOST_CHECK_EQUAL(counted::alive, 2);
+	}
+	BOOST_CHECK_EQUAL(counted::alive, 0);
+
+	// The string column is moved, but only after the fragile column has been copied
+	{
+		vta::soa_vector<std::string, fragile> v;
+		fragile::copies_left = 1000;
+		for(int i = 0; i < 8; ++i) {
+			v.push_back(std::to_string(i), i);
+		}
+		BOOST_CHECK_EQUAL(v.capacity(), 8u);
+		fragile::copies_left = 3;
+		BOOST_CHECK_THROW(v.push_back("8", 8), std::runtime_error);
+		BOOST_CHECK_EQUAL(v.size(), 8u);
+		for(int i = 0; i < 8; ++i) {
+			BOOST_CHECK_EQUAL(v.column<0>()[i], std::to_string(i));
+			BOOST_CHECK_EQUAL(v.column<1>()[i].value, i);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+#include "vta/string_switch.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// Returns which of the commands is input, or -1
+int command(std::string const& input) {
+	int result = -1;
+	vta::string_switch(input,
+	                   vta::string_case(VTA_STRING("GET"), [&result] { result = 0; }),
+	                   vta::string_case(VTA_STRING("SET"), [&result] { result = 1; }),
+	                   vta::string_case(VTA_STRING("GETSET"), [&result] { result = 2; }),
+	                   vta::string_case(VTA_STRING(""), [&result] { result = 3; }),
+	                   vta::string_case(VTA_STRING("a\0b"), [&result] { result = 4; }));
+	return result;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(string_switch)
+
+BOOST_AUTO_TEST_CASE(matches_each_string) {
+	BOOST_CHECK_EQUAL(command("GET"), 0);
+	BOOST_CHECK_EQUAL(command("SET"), 1);
+	BOOST_CHECK_EQUAL(command("GETSET"), 2);
+	BOOST_CHECK_EQUAL(command(""), 3);
+	BOOST_CHECK_EQUAL(command(std::string("a\0b", 3)), 4);
+}
+
+BOOST_AUTO_TEST_CASE(rejects_other_strings) {
+	BOOST_CHECK_EQUAL(command("get"), -1);
+	BOOST_CHECK_EQUAL(command("GE"), -1);
+	BOOST_CHECK_EQUAL(command("GETS"), -1);
+	BOOST_CHECK_EQUAL(command("SET "), -1);
+	BOOST_CHECK_EQUAL(command("a"), -1);
+	BOOST_CHECK_EQUAL(command(std::string("a\0c", 3)), -1);
+
+	BOOST_CHECK(!vta::string_switch(std::string("GET")));
+}
+
+BOOST_AUTO_TEST_CASE(returns_whether_a_case_was_called) {
+	std::vector<std::string> calls;
+	auto const on_add = [&calls] { calls.push_back("add"); };
+	BOOST_CHECK(vta::string_switch(std::string("add"), vta::string_case(VTA_STRING("add"), on_add),
+	                               vta::string_case(VTA_STRING("remove"), [&calls] { calls.push_back("remove"); })));
+	BOOST_CHECK(!vta::string_switch(std::string("clear"), vta::string_case(VTA_STRING("add"), on_add)));
+	BOOST_CHECK((calls == std::vector<std::string>{"add"}));
+}
+
+BOOST_AUTO_TEST_CASE(many_strings) {
+	std::vector<int> hits(12);
+	auto const hit = [&hits](int i) { return [&hits, i] { ++hits[i]; }; };
+	char const* const inputs[] = {"zero", "one", "two", "three", "four", "five",
+	                              "six", "seven", "eight", "nine", "ten", "eleven"};
+	for(char const* input : inputs) {
+		BOOST_CHECK(vta::string_switch(std::string(input),
+		                               vta::string_case(VTA_STRING("zero"), hit(0)),
+		                               vta::string_case(VTA_STRING("one"), hit(1)),
+		                               vta::string_case(VTA_STRING("two"), hit(2)),
+		                               vta::string_case(VTA_STRING("three"), hit(3)),
+		                               vta::string_case(VTA_STRING("four"), hit(4)),
+		                               vta::string_case(VTA_STRING("five"), hit(5)),
+		                               vta::string_case(VTA_STRING("six"), hit(6)),
+		                               vta::string_case(VTA_STRING("seven"), hit(7)),
+		                               vta::string_case(VTA_STRING("eight"), hit(8)),
+		                               vta::string_case(VTA_STRING("nine"), hit(9)),
+		                               vta::string_case(VTA_STRING("ten"), hit(10)),
+		                               vta::string_case(VTA_STRING("eleven"), hit(11))));
+	}
+	BOOST_CHECK((hits == std::vector<int>(12, 1)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
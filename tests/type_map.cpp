@@ -0,0 +1,121 @@
+#include "vta/type_map.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct a {};
+struct b {};
+
+namespace other {
+
+struct a {};
+
+}
+
+typedef vta::type_map<int, a, b, other::a, int, std::string> map_type;
+
+// Records the types and values that a type_map passes to it
+struct collect {
+	std::vector<std::string>* names;
+
+	void operator()(vta::type_tag<a>, int value) const {
+		names->push_back("a" + std::to_string(value));
+	}
+
+	void operator()(vta::type_tag<b>, int value) const {
+		names->push_back("b" + std::to_string(value));
+	}
+
+	void operator()(vta::type_tag<other::a>, int value) const {
+		names->push_back("other::a" + std::to_string(value));
+	}
+
+	void operator()(vta::type_tag<int>, int value) const {
+		names->push_back("int" + std::to_string(value));
+	}
+
+	void operator()(vta::type_tag<std::string>, int value) const {
+		names->push_back("string" + std::to_string(value));
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(type_map)
+
+BOOST_AUTO_TEST_CASE(dense_indices) {
+	static_assert(map_type::size() == 5, "");
+	static_assert(map_type::index_of<a>() == 0, "");
+	static_assert(map_type::index_of<other::a>() == 2, "");
+	static_assert(map_type::index_of<std::string>() == 4, "");
+
+	map_type m;
+	BOOST_CHECK_EQUAL(m.get<b>(), 0);
+	m.get<b>() = 3;
+	m.get<int>() = 4;
+	map_type const& c = m;
+	BOOST_CHECK_EQUAL(c.get<b>(), 3);
+	BOOST_CHECK_EQUAL(c.get<int>(), 4);
+	BOOST_CHECK_EQUAL(c.get<a>(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(type_ids) {
+	static_assert(vta::type_id<a>() != vta::type_id<other::a>(), "");
+	static_assert(vta::type_id<int>() != vta::type_id<int const>(), "");
+	static_assert(vta::type_id<a>() == vta::type_id<a>(), "");
+}
+
+BOOST_AUTO_TEST_CASE(find_by_type_id) {
+	map_type m(1);
+	static_assert(map_type::find_index(vta::type_id<other::a>()) == 2, "");
+	static_assert(map_type::find_index(vta::type_id<double>()) == -1, "");
+
+	BOOST_REQUIRE(m.find(vta::type_id<std::string>()) != nullptr);
+	*m.find(vta::type_id<std::string>()) = 5;
+	BOOST_CHECK_EQUAL(m.get<std::string>(), 5);
+	BOOST_CHECK(m.find(vta::type_id<double>()) == nullptr);
+	BOOST_CHECK(m.find(0) == nullptr);
+
+	// Every type is found at its own index
+	std::uint64_t const ids[] = {vta::type_id<a>(), vta::type_id<b>(), vta::type_id<other::a>(),
+	                             vta::type_id<int>(), vta::type_id<std::string>()};
+	for(int i = 0; i < 5; ++i) {
+		BOOST_CHECK_EQUAL(map_type::find_index(ids[i]), i);
+	}
+
+	static_assert(vta::type_map<int>::find_index(vta::type_id<int>()) == -1, "");
+}
+
+BOOST_AUTO_TEST_CASE(visit) {
+	map_type m(1);
+	m.get<other::a>() = 2;
+	std::vector<std::string> names;
+	BOOST_CHECK(m.visit(vta::type_id<other::a>(), collect{&names}));
+	BOOST_CHECK(!m.visit(vta::type_id<double>(), collect{&names}));
+
+	map_type const& c = m;
+	BOOST_CHECK(c.visit(vta::type_id<int>(), collect{&names}));
+	BOOST_CHECK((names == std::vector<std::string>{"other::a2", "int1"}));
+
+	// The value is passed by reference
+	m.visit(vta::type_id<b>(), [](auto, int& value) { value = 7; });
+	BOOST_CHECK_EQUAL(m.get<b>(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(for_each) {
+	map_type m;
+	int next = 0;
+	m.for_each([&next](auto, int& value) { value = next++; });
+
+	std::vector<std::string> names;
+	m.for_each(collect{&names});
+	BOOST_CHECK((names == std::vector<std::string>{"a0", "b1", "other::a2", "int3", "string4"}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()